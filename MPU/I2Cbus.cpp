@@ -0,0 +1,320 @@
+// I2Cdev library collection - Linux i2c-dev bus handle cache
+// Keeps one open descriptor per adapter so I2Cdev transfers don't pay for an
+// open()/ioctl(I2C_SLAVE)/close() sequence on every register access. The
+// descriptor lives in a transport (I2Clinux unless another one is installed
+// with setTransport(), e.g. the I2Csim simulator). Threads waiting for an
+// adapter get it earliest-due first: every transfer is due at the thread's
+// I2Cdev deadline, or a class-dependent slack after it asked for the bus.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include "I2Cbus.h"
+#include "I2Clinux.h"
+
+std::atomic<I2Cbus *> I2Cbus::buses[I2CBUS_MAX_ADAPTERS];
+bool I2Cbus::exitHookInstalled = false;
+std::mutex I2Cbus::busesMutex;
+
+// The calling thread's priority class and absolute due time (ns, 0 if none).
+static thread_local uint8_t threadPriority = I2CBUS_PRIORITY_NORMAL;
+static thread_local uint64_t threadDue = 0;
+
+static const uint64_t slackNs[I2CBUS_PRIORITIES] = {
+    I2CBUS_SLACK_URGENT_US * 1000ull, I2CBUS_SLACK_NORMAL_US * 1000ull, I2CBUS_SLACK_BULK_US * 1000ull
+};
+
+I2Cbus::I2Cbus(uint8_t adapter) : adapter(adapter), transport(NULL), ownsTransport(false),
+        slaveAddr(-1), timeoutTicks(-1), retries(-1), funcs(0), funcsKnown(false), ready(false), held(false) {
+}
+
+/** Get the shared handle for an adapter, opening it on first use.
+ * The descriptor stays open until close() or closeAll() is called; closeAll()
+ * is registered with atexit() the first time any adapter is opened. Every
+ * adapter has its own descriptor and lock, and an open adapter is found
+ * without taking any lock shared with other adapters, so devices on
+ * different buses can be driven concurrently from different threads.
+ * @param adapter Adapter number (N in /dev/i2c-N)
+ * @return Bus handle, or NULL if the adapter could not be opened (errno is set)
+ */
+I2Cbus *I2Cbus::get(uint8_t adapter) {
+    if (adapter >= I2CBUS_MAX_ADAPTERS) {
+        errno = EINVAL;
+        return NULL;
+    }
+    I2Cbus *bus = buses[adapter].load(std::memory_order_acquire);
+    if (bus != NULL && bus->ready.load(std::memory_order_acquire)) {
+        return bus;
+    }
+
+    std::lock_guard<std::mutex> guard(busesMutex);
+    if ((bus = buses[adapter].load(std::memory_order_relaxed)) == NULL) {
+        bus = new I2Cbus(adapter);
+        buses[adapter].store(bus, std::memory_order_release);
+    }
+    if (!bus->isOpen() && bus->open() < 0) {
+        return NULL;
+    }
+    bus->ready.store(true, std::memory_order_release);
+    return bus;
+}
+
+/** Close every adapter opened through get().
+ * Safe to call more than once; a later get() simply reopens the adapter.
+ */
+void I2Cbus::closeAll() {
+    std::lock_guard<std::mutex> guard(busesMutex);
+    for (int i = 0; i < I2CBUS_MAX_ADAPTERS; i++) {
+        I2Cbus *bus = buses[i].load(std::memory_order_relaxed);
+        if (bus != NULL) bus->close();
+    }
+}
+
+/** Drive an adapter through a different transport, e.g. an I2Csim.
+ * The adapter's current transport is closed; the new one is opened on the
+ * next get(). The caller keeps ownership of transport and must keep it alive
+ * until it is replaced or the program ends; NULL restores i2c-dev.
+ * @param adapter Adapter number (N in /dev/i2c-N)
+ * @param transport Transport to use from now on, NULL for the default
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Cbus::setTransport(uint8_t adapter, I2Ctransport *transport) {
+    if (adapter >= I2CBUS_MAX_ADAPTERS) {
+        errno = EINVAL;
+        return -1;
+    }
+    std::lock_guard<std::mutex> guard(busesMutex);
+    I2Cbus *bus = buses[adapter].load(std::memory_order_relaxed);
+    if (bus == NULL) {
+        bus = new I2Cbus(adapter);
+        buses[adapter].store(bus, std::memory_order_release);
+    }
+    bus->close();
+    std::lock_guard<I2Cbus> busGuard(*bus);
+    if (bus->ownsTransport) delete bus->transport;
+    bus->transport = transport;
+    bus->ownsTransport = false;
+    return 0;
+}
+
+/** Set the priority class of the calling thread's transfers; see also
+ * I2Cpriority, which sets it for one scope. In I2CBUS_PRIORITY_BULK, I2Cdev
+ * and I2Ctransaction also cut long transfers into I2CBUS_BULK_CHUNK pieces
+ * and give up the bus between them.
+ * @param priority I2CBUS_PRIORITY_*
+ */
+void I2Cbus::setPriority(uint8_t priority) {
+    threadPriority = priority < I2CBUS_PRIORITIES ? priority : I2CBUS_PRIORITIES - 1;
+}
+
+/** Get the priority class of the calling thread's transfers.
+ * @return I2CBUS_PRIORITY_*
+ */
+uint8_t I2Cbus::getPriority() {
+    return threadPriority;
+}
+
+/** Make the calling thread's transfers due at a fixed time instead of their
+ * class's slack after they ask for the bus. I2Cdev::setDeadline() sets it
+ * too; unlike a deadline, a due time never fails a transfer.
+ * @param due CLOCK_MONOTONIC time in nanoseconds, 0 to clear
+ */
+void I2Cbus::setDue(uint64_t due) {
+    threadDue = due;
+}
+
+/** Get the time a transfer of the calling thread starting now is due.
+ * @return CLOCK_MONOTONIC time in nanoseconds
+ */
+uint64_t I2Cbus::dueTime() {
+    return threadDue != 0 ? threadDue : monotonicNs() + slackNs[threadPriority];
+}
+
+/** Take the adapter, waiting behind any thread whose transfer is due earlier.
+ */
+void I2Cbus::lock() {
+    std::unique_lock<std::mutex> guard(gate);
+    Waiter waiter;
+
+    if (!held) {
+        held = true;
+        return;
+    }
+    waiter.granted = false;
+    // equal due times queue behind each other, in arrival order
+    waiters.insert(std::make_pair(dueTime(), &waiter));
+    while (!waiter.granted) waiter.wake.wait(guard);
+}
+
+/** Release the adapter, handing it to the earliest-due waiter if any.
+ */
+void I2Cbus::unlock() {
+    std::lock_guard<std::mutex> guard(gate);
+
+    if (waiters.empty()) {
+        held = false;
+        return;
+    }
+    Waiter *next = waiters.begin()->second;
+    waiters.erase(waiters.begin());
+    next->granted = true;
+    next->wake.notify_one();
+}
+
+/** Address a slave device on this bus.
+ * The kernel remembers the slave address per descriptor, so the ioctl is only
+ * issued when devAddr differs from the last address selected. The caller must
+ * hold lock() until the read()/write() addressed to the device is done.
+ * @param devAddr I2C slave device address (7-bit)
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Cbus::select(uint8_t devAddr) {
+    if (slaveAddr == devAddr) return 0;
+    if (transport->setSlave(devAddr) < 0) {
+        slaveAddr = -1;
+        return -1;
+    }
+    slaveAddr = devAddr;
+    return 0;
+}
+
+/** Run several messages as one combined transaction (I2C_RDWR).
+ * Messages are separated by repeated starts with a single STOP at the end, so
+ * no other master can get onto the bus between them. Each message carries its
+ * own slave address; the address set by select() is neither used nor changed.
+ * @param msgs Messages to transfer, in bus order
+ * @param count Number of messages (at most I2C_RDWR_IOCTL_MAX_MSGS)
+ * @return Number of messages transferred, or -1 on failure (errno is set)
+ */
+int I2Cbus::transfer(struct i2c_msg *msgs, int count) {
+    return transport->transfer(msgs, count);
+}
+
+/** Write to the device chosen with select().
+ * @param buf Bytes to send, usually a register address followed by data
+ * @param length Number of bytes
+ * @return Number of bytes written, or -1 on failure (errno is set)
+ */
+int I2Cbus::write(const uint8_t *buf, uint16_t length) {
+    return transport->write(buf, length);
+}
+
+/** Read from the device chosen with select().
+ * @param buf Buffer to store read data in
+ * @param length Number of bytes
+ * @return Number of bytes read, or -1 on failure (errno is set)
+ */
+int I2Cbus::read(uint8_t *buf, uint16_t length) {
+    return transport->read(buf, length);
+}
+
+/** Set how long the adapter driver waits for a transfer to complete.
+ * The kernel counts in 10 ms ticks, so ms is rounded up. The setting belongs
+ * to the adapter, not the descriptor; the ioctl is skipped when the rounded
+ * value is already in force.
+ * @param ms Timeout in milliseconds (0 is treated as one tick)
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Cbus::setTimeout(uint16_t ms) {
+    int32_t ticks = (ms + 9) / 10;
+
+    if (ticks == 0) ticks = 1;
+    if (ticks == timeoutTicks) return 0;
+    if (transport->setTimeout(ticks) < 0) {
+        timeoutTicks = -1;
+        return -1;
+    }
+    timeoutTicks = ticks;
+    return 0;
+}
+
+/** Set how many times the adapter driver retries a transfer that lost
+ * arbitration. The ioctl is skipped when the value is already in force.
+ * @param count Number of retries
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Cbus::setRetries(uint8_t count) {
+    if (count == retries) return 0;
+    if (transport->setRetries(count) < 0) {
+        retries = -1;
+        return -1;
+    }
+    retries = count;
+    return 0;
+}
+
+/** Check whether the adapter driver can do something (I2C_FUNCS).
+ * Asked once per open; the caller must hold lock().
+ * @param func I2C_FUNC_* bit(s) from linux/i2c.h
+ * @return True if every bit in func is supported
+ */
+bool I2Cbus::supports(unsigned long func) {
+    if (!funcsKnown) {
+        if (transport->getFunctionality(&funcs) < 0) funcs = 0;
+        funcsKnown = true;
+    }
+    return (funcs & func) == func;
+}
+
+/** Release the adapter descriptor.
+ */
+void I2Cbus::close() {
+    ready.store(false, std::memory_order_release);
+    std::lock_guard<I2Cbus> guard(*this);
+    if (transport != NULL) {
+        transport->close();
+    }
+    slaveAddr = -1;
+    timeoutTicks = -1;
+    retries = -1;
+    funcsKnown = false;
+}
+
+int I2Cbus::open() {
+    if (transport == NULL) {
+        transport = new I2Clinux();
+        ownsTransport = true;
+    }
+    if (transport->open(adapter) < 0) {
+        return -1;
+    }
+    slaveAddr = -1;
+    timeoutTicks = -1;
+    retries = -1;
+    funcsKnown = false;
+    if (!exitHookInstalled) {
+        atexit(closeAll);
+        exitHookInstalled = true;
+    }
+    return 0;
+}
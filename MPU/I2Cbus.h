@@ -0,0 +1,160 @@
+// I2Cdev library collection - Linux i2c-dev bus handle cache
+// Keeps one open descriptor per adapter so I2Cdev transfers don't pay for an
+// open()/ioctl(I2C_SLAVE)/close() sequence on every register access. The
+// descriptor lives in a transport (I2Clinux unless another one is installed
+// with setTransport(), e.g. the I2Csim simulator). Threads waiting for an
+// adapter get it earliest-due first: every transfer is due at the thread's
+// I2Cdev deadline, or a class-dependent slack after it asked for the bus.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CBUS_H_
+#define _I2CBUS_H_
+
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include "I2Ctransport.h"
+
+#define I2CBUS_MAX_ADAPTERS     32  // covers /dev/i2c-0 .. /dev/i2c-31
+#define I2CBUS_DEFAULT_ADAPTER  1   // the 40-pin header bus on a Pi
+#define I2CBUS_DEFAULT_TIMEOUT  1000 // ms, what most adapter drivers start with (HZ)
+#define I2CBUS_DEFAULT_RETRIES  3   // arbitration retries outside a deadline
+
+// Priority classes of a thread's transfers, see setPriority(). A transfer
+// that asks for the bus is due its class's slack later, unless the thread
+// has a deadline; waiting transfers run earliest-due first, so bulk work
+// ages into its turn instead of starving.
+#define I2CBUS_PRIORITY_URGENT  0   // sensor samples, FIFO drains
+#define I2CBUS_PRIORITY_NORMAL  1
+#define I2CBUS_PRIORITY_BULK    2   // firmware uploads, verification, dumps
+#define I2CBUS_PRIORITIES       3
+#define I2CBUS_SLACK_URGENT_US  1000
+#define I2CBUS_SLACK_NORMAL_US  20000
+#define I2CBUS_SLACK_BULK_US    200000
+#define I2CBUS_BULK_CHUNK       64  // bytes per transfer in the bulk class, ~1.6 ms at 400 kHz
+
+// A device address may name the adapter the device sits on in its high byte
+// (adapter + 1), so one 16-bit value identifies a device anywhere in the
+// system. A plain 7-bit address (high byte 0) means the default adapter.
+#define I2CBUS_ADDRESS(adapter, addr)   ((uint16_t)((((adapter) + 1) << 8) | ((addr) & 0x7F)))
+#define I2CBUS_ADAPTER(devAddr)         (((devAddr) >> 8) ? (((devAddr) >> 8) - 1) : I2CBUS_DEFAULT_ADAPTER)
+#define I2CBUS_SLAVE(devAddr)           ((devAddr) & 0x7F)
+
+// CLOCK_MONOTONIC in nanoseconds: the clock of every timestamp, deadline and
+// timeout in the library (I2Cdev::setDeadline(), I2Cstats, I2Ctrace).
+inline uint64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+struct i2c_msg;
+
+class I2Cbus {
+    public:
+        static I2Cbus *get(uint8_t adapter=I2CBUS_DEFAULT_ADAPTER);
+        static I2Cbus *forDevice(uint16_t devAddr) { return get(I2CBUS_ADAPTER(devAddr)); }
+        static void closeAll();
+        static int setTransport(uint8_t adapter, I2Ctransport *transport);
+
+        static void setPriority(uint8_t priority);
+        static uint8_t getPriority();
+        static void setDue(uint64_t due);
+        static uint64_t dueTime();
+
+        // Held around every transfer, and around select() and the plain
+        // read()/write() that depends on it; each adapter has its own lock,
+        // so separate buses never wait on each other.
+        void lock();
+        void unlock();
+
+        int select(uint8_t devAddr);
+        int transfer(struct i2c_msg *msgs, int count);
+        int write(const uint8_t *buf, uint16_t length);
+        int read(uint8_t *buf, uint16_t length);
+        int setTimeout(uint16_t ms);
+        int setRetries(uint8_t count);
+        bool supports(unsigned long func);
+        void close();
+
+        int handle() const { return transport != NULL ? transport->handle() : -1; }
+        bool isOpen() const { return transport != NULL && transport->isOpen(); }
+        uint8_t number() const { return adapter; }
+
+    private:
+        I2Cbus(uint8_t adapter);
+        int open();
+
+        uint8_t adapter;
+        I2Ctransport *transport;
+        bool ownsTransport;   // the default I2Clinux, created by open()
+        int16_t slaveAddr;  // -1 until I2C_SLAVE has been issued
+        int32_t timeoutTicks; // last I2C_TIMEOUT value set, -1 if never set
+        int16_t retries;    // last I2C_RETRIES value set, -1 if never set
+        unsigned long funcs; // I2C_FUNCS of the adapter, once asked
+        bool funcsKnown;
+        std::atomic<bool> ready; // open, get() may hand it out without busesMutex
+
+        // The bus lock: held says whether some thread owns the adapter, and
+        // unlock() hands it straight to the earliest-due waiter. gate only
+        // guards these, it is never held during a transfer.
+        struct Waiter {
+            std::condition_variable wake;
+            bool granted;
+        };
+        std::mutex gate;
+        bool held;
+        std::multimap<uint64_t, Waiter *> waiters;
+
+        // Published once and never freed, so get() reads them without a
+        // lock; busesMutex only serializes creating and (re)opening.
+        static std::atomic<I2Cbus *> buses[I2CBUS_MAX_ADAPTERS];
+        static std::mutex busesMutex;
+        static bool exitHookInstalled;
+};
+
+/** Runs the transfers of the enclosing scope in a priority class, then
+ * restores the thread's previous class.
+ */
+class I2Cpriority {
+    public:
+        explicit I2Cpriority(uint8_t priority) : previous(I2Cbus::getPriority()) { I2Cbus::setPriority(priority); }
+        ~I2Cpriority() { I2Cbus::setPriority(previous); }
+
+        I2Cpriority(const I2Cpriority &) = delete;
+        I2Cpriority &operator=(const I2Cpriority &) = delete;
+
+    private:
+        uint8_t previous;
+};
+
+#endif /* _I2CBUS_H_ */
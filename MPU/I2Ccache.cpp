@@ -0,0 +1,325 @@
+// I2Cdev library collection - shadow register cache
+// Opt-in per-device copy of register contents, used as the base for I2Cdev's
+// read-modify-write bit writers so configuration costs one write per register
+// instead of a read and a write. In write-back mode register writes only
+// update the shadow, and flush() sends each dirty register once, contiguous
+// ones as a single auto-increment burst.
+//
+// Changelog:
+//     2026-10-17 - initial release
+//     2026-10-17 - write-back mode
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "I2Ccache.h"
+#include "I2Ctransaction.h"
+
+#define BIT_SET(map, reg)   ((map)[(reg) >> 5] & (1u << ((reg) & 31)))
+
+std::atomic<I2Ccache::Shadow *> I2Ccache::shadows[I2CBUS_MAX_ADAPTERS * 128];
+std::mutex I2Ccache::shadowsMutex;
+
+/** Start shadowing the registers of a device.
+ * Nothing is read up front: a register becomes cached the first time it is
+ * read or written through I2Cdev or I2Ctransaction. Registers whose contents
+ * change on their own (status, data, FIFO, self-clearing bits) must be marked
+ * with setVolatile() or the bit writers will write back stale values.
+ * @param devAddr I2C slave device address
+ */
+void I2Ccache::enable(uint16_t devAddr) {
+    Shadow *entry = shadow(devAddr);
+
+    if (entry == NULL) {
+        std::lock_guard<std::mutex> guard(shadowsMutex);
+        std::atomic<Shadow *> &slot = shadows[I2CBUS_ADAPTER(devAddr) * 128 + I2CBUS_SLAVE(devAddr)];
+        if ((entry = slot.load(std::memory_order_relaxed)) == NULL) {
+            entry = new Shadow();
+            slot.store(entry, std::memory_order_release);
+        }
+    }
+    std::lock_guard<std::mutex> guard(entry->lock);
+    if (entry->active.load(std::memory_order_relaxed)) return;
+    memset(entry->valid, 0, sizeof(entry->valid));
+    memset(entry->uncached, 0, sizeof(entry->uncached));
+    memset(entry->dirty, 0, sizeof(entry->dirty));
+    entry->writeBack = false;
+    entry->active.store(true, std::memory_order_relaxed);
+}
+
+/** Stop shadowing a device and drop its cached values.
+ * Buffered writes are dropped too; flush() first to keep them.
+ * @param devAddr I2C slave device address
+ */
+void I2Ccache::disable(uint16_t devAddr) {
+    Shadow *entry = shadow(devAddr);
+    if (entry == NULL) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    entry->active.store(false, std::memory_order_relaxed);
+    memset(entry->valid, 0, sizeof(entry->valid));
+    memset(entry->dirty, 0, sizeof(entry->dirty));
+}
+
+/** Check whether a device has a shadow cache.
+ * @param devAddr I2C slave device address
+ * @return True if enable() has been called for the device
+ */
+bool I2Ccache::enabled(uint16_t devAddr) {
+    Shadow *entry = shadow(devAddr);
+    return entry != NULL && entry->active.load(std::memory_order_relaxed);
+}
+
+/** Exclude a range of registers from the cache.
+ * @param devAddr I2C slave device address
+ * @param firstReg First register of the range
+ * @param lastReg Last register of the range (inclusive)
+ */
+void I2Ccache::setVolatile(uint16_t devAddr, uint8_t firstReg, uint8_t lastReg) {
+    Shadow *entry = shadow(devAddr);
+    if (entry == NULL) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    if (!entry->active.load(std::memory_order_relaxed)) return;
+    for (unsigned reg = firstReg; reg <= lastReg; reg++) {
+        entry->uncached[reg >> 5] |= 1u << (reg & 31);
+        entry->valid[reg >> 5] &= ~(1u << (reg & 31));
+    }
+}
+
+/** Forget every cached value of a device, e.g. after a device reset.
+ * The next read-modify-write of each register goes to the bus again.
+ * Buffered writes are dropped as well.
+ * @param devAddr I2C slave device address
+ */
+void I2Ccache::invalidate(uint16_t devAddr) {
+    Shadow *entry = shadow(devAddr);
+    if (entry == NULL) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    memset(entry->valid, 0, sizeof(entry->valid));
+    memset(entry->dirty, 0, sizeof(entry->dirty));
+}
+
+/** Re-read every cached register of a device from the bus.
+ * Consecutive cached registers are fetched as one burst and all bursts are
+ * submitted as a single batched transaction, after any buffered writes have
+ * been flushed; the values reach the cache through update(). On failure the
+ * cache is invalidated rather than left partially stale.
+ * @param devAddr I2C slave device address
+ * @return Status of operation (true = success)
+ */
+bool I2Ccache::resync(uint16_t devAddr) {
+    Shadow *entry = shadow(devAddr);
+    I2Ctransaction transaction(I2CBUS_ADAPTER(devAddr));
+    uint8_t value[256];
+    uint32_t valid[8];
+    unsigned reg, first;
+
+    if (entry == NULL || !entry->active.load(std::memory_order_relaxed)) return true;
+    if (!flush(devAddr)) return false;
+    {
+        std::lock_guard<std::mutex> guard(entry->lock);
+        memcpy(valid, entry->valid, sizeof(valid));
+    }
+    for (reg = 0; reg < 256;) {
+        if (!BIT_SET(valid, reg)) {
+            reg++;
+            continue;
+        }
+        for (first = reg; reg < 256 && BIT_SET(valid, reg); reg++);
+        transaction.readBytes(devAddr, first, reg - first, value + first);
+    }
+    if (!transaction.submit()) {
+        invalidate(devAddr);
+        return false;
+    }
+    return true;
+}
+
+/** Switch a device between write-through (the default) and write-back.
+ * In write-back mode writes to cacheable registers only update the shadow
+ * and mark the registers dirty; the device sees them at the next flush().
+ * A write that cannot be buffered (it touches a volatile register) flushes
+ * first, and so does every I2Ctransaction addressed to the device, so the
+ * device still sees writes in program order. Enables the cache if needed.
+ * Switching back to write-through flushes.
+ * @param devAddr I2C slave device address
+ * @param enabled True for write-back
+ */
+void I2Ccache::setWriteBack(uint16_t devAddr, bool enabled) {
+    enable(devAddr);
+    Shadow *entry = shadow(devAddr);
+    if (!enabled) {
+        // no new buffered writes once the flush has started
+        {
+            std::lock_guard<std::mutex> guard(entry->lock);
+            entry->writeBack = false;
+        }
+        flush(devAddr);
+        return;
+    }
+    std::lock_guard<std::mutex> guard(entry->lock);
+    entry->writeBack = true;
+}
+
+/** Write every dirty register of a device.
+ * Runs of consecutive dirty registers go out as one auto-increment burst
+ * each, all runs in one batched transaction. Registers stay dirty if the
+ * transaction fails. Writes buffered while the flush is on the bus stay
+ * dirty for the next one.
+ * @param devAddr I2C slave device address
+ * @return Status of operation (true = nothing was left dirty)
+ */
+bool I2Ccache::flush(uint16_t devAddr) {
+    Shadow *entry = shadow(devAddr);
+    uint32_t dirty[8];
+    unsigned reg, first;
+    bool any = false;
+
+    if (entry == NULL) return true;
+    std::lock_guard<std::recursive_mutex> flushGuard(entry->flushing);
+    I2Ctransaction transaction(I2CBUS_ADAPTER(devAddr));
+    {
+        std::lock_guard<std::mutex> guard(entry->lock);
+        for (int i = 0; i < 8; i++) any |= entry->dirty[i] != 0;
+        if (!any) return true;
+
+        // clean before submitting: submit() flushes its devices first
+        memcpy(dirty, entry->dirty, sizeof(dirty));
+        memset(entry->dirty, 0, sizeof(entry->dirty));
+        for (reg = 0; reg < 256;) {
+            if (!BIT_SET(dirty, reg)) {
+                reg++;
+                continue;
+            }
+            for (first = reg; reg < 256 && reg - first < 255 && BIT_SET(dirty, reg); reg++);
+            // copies the values, so the shadow may change during submit()
+            transaction.writeBytes(devAddr, first, reg - first, entry->value + first);
+        }
+    }
+    if (!transaction.submit()) {
+        std::lock_guard<std::mutex> guard(entry->lock);
+        if (entry->active.load(std::memory_order_relaxed)) {
+            for (int i = 0; i < 8; i++) entry->dirty[i] |= dirty[i];
+        }
+        return false;
+    }
+    return true;
+}
+
+/** Flush every device in write-back mode, e.g. at the end of a control loop
+ * pass.
+ * @return Status of operation (true = every flush succeeded)
+ */
+bool I2Ccache::flushAll() {
+    bool status = true;
+    for (unsigned i = 0; i < I2CBUS_MAX_ADAPTERS * 128; i++) {
+        if (shadows[i].load(std::memory_order_acquire) != NULL &&
+                !flush(I2CBUS_ADDRESS(i / 128, i % 128))) status = false;
+    }
+    return status;
+}
+
+/** Take a register write into the shadow instead of sending it.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register written
+ * @param length Number of registers written
+ * @param data Values written
+ * @return True if the write was buffered; false if it must go to the bus
+ *         (device not in write-back mode, or a volatile register involved)
+ */
+bool I2Ccache::buffer(uint16_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data) {
+    Shadow *entry = shadow(devAddr);
+    if (entry == NULL || regAddr + length > 256) return false;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    if (!entry->active.load(std::memory_order_relaxed) || !entry->writeBack) return false;
+    for (unsigned reg = regAddr; reg < (unsigned)regAddr + length; reg++) {
+        if (BIT_SET(entry->uncached, reg)) return false;
+    }
+    memcpy(entry->value + regAddr, data, length);
+    for (unsigned reg = regAddr; reg < (unsigned)regAddr + length; reg++) {
+        entry->valid[reg >> 5] |= 1u << (reg & 31);
+        entry->dirty[reg >> 5] |= 1u << (reg & 31);
+    }
+    return true;
+}
+
+/** Replace bytes just read from a device with the values of registers that
+ * have buffered writes, so reads see the device as it will be after flush().
+ * @param devAddr I2C slave device address
+ * @param regAddr First register read
+ * @param length Number of bytes read
+ * @param data Bytes read, patched in place
+ */
+void I2Ccache::overlay(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    Shadow *entry = shadow(devAddr);
+    if (entry == NULL) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    if (!entry->active.load(std::memory_order_relaxed) || !entry->writeBack) return;
+    for (unsigned i = 0, reg = regAddr; i < length && reg < 256; i++, reg++) {
+        if (BIT_SET(entry->dirty, reg)) data[i] = entry->value[reg];
+    }
+}
+
+/** Get cached register values.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register to look up
+ * @param length Number of consecutive registers
+ * @param data Buffer to copy cached values to
+ * @return True if every requested register was cached, false otherwise (data untouched)
+ */
+bool I2Ccache::lookup(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    Shadow *entry = shadow(devAddr);
+    if (entry == NULL || regAddr + length > 256) return false;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    if (!entry->active.load(std::memory_order_relaxed)) return false;
+    for (unsigned reg = regAddr; reg < (unsigned)regAddr + length; reg++) {
+        if (!BIT_SET(entry->valid, reg)) return false;
+    }
+    memcpy(data, entry->value + regAddr, length);
+    return true;
+}
+
+/** Record register values that were just read from or written to a device.
+ * Registers are assumed to auto-increment across the transfer. A transfer
+ * that starts at a volatile register is ignored as a whole, since FIFO and
+ * memory data ports don't auto-increment; devices without a cache are ignored.
+ * Registers with buffered writes keep their buffered value.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register transferred
+ * @param length Number of bytes transferred
+ * @param data Bytes transferred
+ */
+void I2Ccache::update(uint16_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data) {
+    Shadow *entry = shadow(devAddr);
+    if (entry == NULL) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    if (!entry->active.load(std::memory_order_relaxed) || BIT_SET(entry->uncached, regAddr)) return;
+    for (unsigned i = 0, reg = regAddr; i < length && reg < 256; i++, reg++) {
+        if (BIT_SET(entry->uncached, reg) || BIT_SET(entry->dirty, reg)) continue;
+        entry->value[reg] = data[i];
+        entry->valid[reg >> 5] |= 1u << (reg & 31);
+    }
+}
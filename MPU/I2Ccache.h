@@ -0,0 +1,90 @@
+// I2Cdev library collection - shadow register cache
+// Opt-in per-device copy of register contents, used as the base for I2Cdev's
+// read-modify-write bit writers so configuration costs one write per register
+// instead of a read and a write. In write-back mode register writes only
+// update the shadow, and flush() sends each dirty register once, contiguous
+// ones as a single auto-increment burst.
+//
+// Changelog:
+//     2026-10-17 - initial release
+//     2026-10-17 - write-back mode
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CCACHE_H_
+#define _I2CCACHE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include "I2Cbus.h"
+
+class I2Ccache {
+    public:
+        static void enable(uint16_t devAddr);
+        static void disable(uint16_t devAddr);
+        static bool enabled(uint16_t devAddr);
+        static void setVolatile(uint16_t devAddr, uint8_t firstReg, uint8_t lastReg);
+        static void invalidate(uint16_t devAddr);
+        static bool resync(uint16_t devAddr);
+        static void setWriteBack(uint16_t devAddr, bool enabled);
+        static bool flush(uint16_t devAddr);
+        static bool flushAll();
+
+        static bool buffer(uint16_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data);
+        static void overlay(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+
+        static bool lookup(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        static void update(uint16_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data);
+
+    private:
+        // Callers, I2Cengine workers and I2Cscheduler tasks may all drive the
+        // same device, so everything below is read and written under lock.
+        // lock is never held across a transfer (readAttempt() updates the
+        // cache with the bus held); flushing is, and keeps two flushes of one
+        // device from reaching the bus out of order.
+        struct Shadow {
+            uint8_t value[256];
+            uint32_t valid[8];      // bit per register: value[] matches the device
+            uint32_t uncached[8];   // bit per register: never served from value[]
+            uint32_t dirty[8];      // bit per register: value[] not written to the device yet
+            bool writeBack;
+            std::atomic<bool> active;   // false after disable(); the Shadow itself is kept
+            std::mutex lock;
+            std::recursive_mutex flushing;  // submit() flushes the device again
+        };
+
+        static Shadow *shadow(uint16_t devAddr) {
+            return shadows[I2CBUS_ADAPTER(devAddr) * 128 + I2CBUS_SLAVE(devAddr)].load(std::memory_order_acquire);
+        }
+
+        // One slot per (adapter, 7-bit address); see I2CBUS_ADDRESS(). A
+        // Shadow is never freed once published, so a thread that still holds
+        // one after disable() finds it inactive instead of freed.
+        static std::atomic<Shadow *> shadows[I2CBUS_MAX_ADAPTERS * 128];
+        static std::mutex shadowsMutex;
+};
+
+#endif /* _I2CCACHE_H_ */
@@ -0,0 +1,216 @@
+// I2Cdev library collection - per-tick read coalescing
+// Opt-in per device: register reads made during one tick (one pass of the
+// caller's control loop) are served from a snapshot, and the registers read
+// during the previous tick are fetched as a few merged bursts the first time
+// any of them is needed, so separate per-axis getters cost one transaction
+// per tick between them instead of one each.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "I2Ccoalesce.h"
+
+#define BIT_SET(map, reg)   ((map)[(reg) >> 5] & (1u << ((reg) & 31)))
+#define SET_BIT(map, reg)   ((map)[(reg) >> 5] |= 1u << ((reg) & 31))
+
+I2Ccoalesce::Window *I2Ccoalesce::windows[I2CBUS_MAX_ADAPTERS * 128];
+std::atomic<uint32_t> I2Ccoalesce::epoch(1);
+uint8_t I2Ccoalesce::gap = I2CCOALESCE_GAP;
+
+/** Start coalescing reads of a device.
+ * Registers that must not be read more often or earlier than asked for
+ * (FIFO and memory ports, clear-on-read status) must be marked with
+ * setExcluded(). Like I2Ccache::enable(), not to be called while other
+ * threads are using the device.
+ * @param devAddr I2C slave device address
+ */
+void I2Ccoalesce::enable(uint16_t devAddr) {
+    if (window(devAddr) == NULL) {
+        Window *entry = new Window();
+        memset(entry->value, 0, sizeof(entry->value));
+        memset(entry->valid, 0, sizeof(entry->valid));
+        memset(entry->wanted, 0, sizeof(entry->wanted));
+        memset(entry->excluded, 0, sizeof(entry->excluded));
+        entry->epoch = epoch.load(std::memory_order_relaxed);
+        entry->spanCount = 0;
+        window(devAddr) = entry;
+    }
+}
+
+/** Stop coalescing reads of a device; every read goes to the bus again.
+ * @param devAddr I2C slave device address
+ */
+void I2Ccoalesce::disable(uint16_t devAddr) {
+    delete window(devAddr);
+    window(devAddr) = NULL;
+}
+
+/** Always read a range of registers exactly as asked, never from the
+ * snapshot and never as part of a merged burst.
+ * @param devAddr I2C slave device address
+ * @param firstReg First register of the range
+ * @param lastReg Last register of the range (inclusive)
+ */
+void I2Ccoalesce::setExcluded(uint16_t devAddr, uint8_t firstReg, uint8_t lastReg) {
+    Window *entry = window(devAddr);
+    if (entry == NULL) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    for (unsigned reg = firstReg; reg <= lastReg; reg++) {
+        SET_BIT(entry->excluded, reg);
+        entry->valid[reg >> 5] &= ~(1u << (reg & 31));
+    }
+}
+
+/** Set how many unrequested registers a burst may read to join two ranges.
+ * Every extra register costs a byte time (22.5 us at 400 kHz), every
+ * separate transaction at least a register write and a restart.
+ * @param registers Largest gap bridged (default I2CCOALESCE_GAP)
+ */
+void I2Ccoalesce::setGap(uint8_t registers) {
+    gap = registers;
+}
+
+/** Start a new tick: snapshots of every coalesced device expire, and the
+ * next read of each device fetches what was read during the tick just ended.
+ */
+void I2Ccoalesce::tick() {
+    epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+/** Serve a read from this tick's snapshot, or say what to fetch instead.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register to read
+ * @param length Number of registers
+ * @param data Buffer to copy the snapshot to
+ * @param burstReg Set to the first register to fetch on a miss
+ * @param burstLength Set to the number of registers to fetch on a miss; the
+ *        burst covers the request, which is at regAddr - *burstReg in it
+ * @return True if data was served from the snapshot
+ */
+bool I2Ccoalesce::lookup(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data,
+        uint8_t *burstReg, uint16_t *burstLength) {
+    Window *entry = window(devAddr);
+    unsigned end = (unsigned)regAddr + length;
+    bool hit = true;
+
+    *burstReg = regAddr;
+    *burstLength = length;
+    if (entry == NULL || end > 256) return false;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    uint32_t now = epoch.load(std::memory_order_relaxed);
+    if (entry->epoch != now) rollover(entry, now);
+
+    for (unsigned reg = regAddr; reg < end; reg++) {
+        if (BIT_SET(entry->excluded, reg)) return false;
+        SET_BIT(entry->wanted, reg);
+        if (!BIT_SET(entry->valid, reg)) hit = false;
+    }
+    if (hit) {
+        memcpy(data, entry->value + regAddr, length);
+        return true;
+    }
+    for (int i = 0; i < entry->spanCount; i++) {
+        const Span &span = entry->spans[i];
+        if (span.regAddr <= regAddr && end <= (unsigned)span.regAddr + span.length) {
+            *burstReg = span.regAddr;
+            *burstLength = span.length;
+            break;
+        }
+    }
+    return false;
+}
+
+/** Record registers just read from the bus in this tick's snapshot.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register read
+ * @param length Number of registers read
+ * @param data Bytes read
+ */
+void I2Ccoalesce::fill(uint16_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data) {
+    Window *entry = window(devAddr);
+    if (entry == NULL || BIT_SET(entry->excluded, regAddr)) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    if (entry->epoch != epoch.load(std::memory_order_relaxed)) return;    // read spanned a tick
+    for (unsigned i = 0, reg = regAddr; i < length && reg < 256; i++, reg++) {
+        if (BIT_SET(entry->excluded, reg)) continue;
+        entry->value[reg] = data[i];
+        SET_BIT(entry->valid, reg);
+    }
+}
+
+/** Drop registers from the snapshot, e.g. because they were just written.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register
+ * @param length Number of registers
+ */
+void I2Ccoalesce::invalidate(uint16_t devAddr, uint8_t regAddr, uint16_t length) {
+    Window *entry = window(devAddr);
+    if (entry == NULL) return;
+    std::lock_guard<std::mutex> guard(entry->lock);
+    for (unsigned i = 0, reg = regAddr; i < length && reg < 256; i++, reg++) {
+        entry->valid[reg >> 5] &= ~(1u << (reg & 31));
+    }
+}
+
+// Plans this tick's bursts from the registers wanted during the last one:
+// runs of wanted registers, joined across at most `gap` unwanted ones but
+// never across an excluded one. A tick without reads keeps the old plan.
+void I2Ccoalesce::rollover(Window *entry, uint32_t now) {
+    bool any = false;
+
+    for (int i = 0; i < 8; i++) any |= entry->wanted[i] != 0;
+    if (any) {
+        int count = 0;
+        unsigned reg = 0;
+
+        while (reg < 256 && count < I2CCOALESCE_SPANS) {
+            if (!BIT_SET(entry->wanted, reg)) {
+                reg++;
+                continue;
+            }
+            unsigned first = reg, last = reg;
+            for (reg++; reg < 256; reg++) {
+                if (BIT_SET(entry->excluded, reg)) break;
+                if (BIT_SET(entry->wanted, reg)) {
+                    last = reg;
+                } else if (reg - last > gap) {
+                    break;
+                }
+            }
+            entry->spans[count].regAddr = first;
+            entry->spans[count].length = last - first + 1;
+            count++;
+            reg = last + 1;
+        }
+        entry->spanCount = count;
+    }
+    memset(entry->valid, 0, sizeof(entry->valid));
+    memset(entry->wanted, 0, sizeof(entry->wanted));
+    entry->epoch = now;
+}
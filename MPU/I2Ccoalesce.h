@@ -0,0 +1,97 @@
+// I2Cdev library collection - per-tick read coalescing
+// Opt-in per device: register reads made during one tick (one pass of the
+// caller's control loop) are served from a snapshot, and the registers read
+// during the previous tick are fetched as a few merged bursts the first time
+// any of them is needed, so separate per-axis getters cost one transaction
+// per tick between them instead of one each.
+//
+// Example:
+//     I2Ccoalesce::enable(MPU6050_DEFAULT_ADDRESS);
+//     while (running) {
+//         I2Ccoalesce::tick();
+//         ax = mpu.getAccelerationX();    // one 0x3B..0x48 burst ...
+//         t = mpu.getTemperature();       // ... both served from it
+//         gx = mpu.getRotationX();
+//     }
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CCOALESCE_H_
+#define _I2CCOALESCE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include "I2Cbus.h"
+
+#define I2CCOALESCE_GAP     4   // unread registers a burst may span to merge two ranges
+#define I2CCOALESCE_SPANS   8   // bursts planned per device and tick
+
+class I2Ccoalesce {
+    public:
+        static void enable(uint16_t devAddr);
+        static void disable(uint16_t devAddr);
+        static bool enabled(uint16_t devAddr) { return window(devAddr) != NULL; }
+        static void setExcluded(uint16_t devAddr, uint8_t firstReg, uint8_t lastReg);
+        static void setGap(uint8_t registers);
+        static void tick();
+
+        static bool lookup(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data,
+            uint8_t *burstReg, uint16_t *burstLength);
+        static void fill(uint16_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data);
+        static void invalidate(uint16_t devAddr, uint8_t regAddr, uint16_t length);
+
+    private:
+        struct Span {
+            uint8_t regAddr;
+            uint16_t length;
+        };
+        struct Window {
+            uint32_t epoch;         // tick the snapshot belongs to
+            uint8_t value[256];
+            uint32_t valid[8];      // bit per register: value[] was read this tick
+            uint32_t wanted[8];     // bit per register: requested this tick
+            uint32_t excluded[8];   // bit per register: never snapshotted or merged
+            Span spans[I2CCOALESCE_SPANS];
+            uint8_t spanCount;
+            std::mutex lock;
+        };
+
+        static void rollover(Window *entry, uint32_t now);
+
+        // One slot per (adapter, 7-bit address); see I2CBUS_ADDRESS()
+        static Window *&window(uint16_t devAddr) {
+            return windows[I2CBUS_ADAPTER(devAddr) * 128 + I2CBUS_SLAVE(devAddr)];
+        }
+
+        static Window *windows[I2CBUS_MAX_ADAPTERS * 128];
+        static std::atomic<uint32_t> epoch;
+        static uint8_t gap;
+};
+
+#endif /* _I2CCOALESCE_H_ */
@@ -48,11 +48,28 @@ THE SOFTWARE.
 #include <unistd.h>
 #include <string.h>
 #include <errno.h>
+#include <time.h>
 #include <sys/ioctl.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "I2Cdev.h"
+#include "I2Cbus.h"
+#include "I2Ccache.h"
+#include "I2Ccoalesce.h"
+#include "I2Cerrors.h"
+#include "I2Cretry.h"
+#include "I2Cstats.h"
+
+// Absolute CLOCK_MONOTONIC deadline (ns) for the calling thread, 0 if none.
+static thread_local uint64_t callDeadline = 0;
 
 /** Default constructor.
  */
@@ -65,12 +82,12 @@ I2Cdev::I2Cdev() {
  * @param bitNum Bit position to read (0-7)
  * @param data Container for single bit value
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Status of read operation (true = success)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBit(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
     uint8_t b;
-    uint8_t count = readByte(devAddr, regAddr, &b, timeout);
-    *data = b & (1 << bitNum);
+    int8_t count = readByte(devAddr, regAddr, &b, timeout);
+    if (count > 0) *data = b & (1 << bitNum);
     return count;
 }
 
@@ -80,12 +97,12 @@ int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @param bitNum Bit position to read (0-15)
  * @param data Container for single bit value
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Status of read operation (true = success)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBitW(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
     uint16_t b;
-    uint8_t count = readWord(devAddr, regAddr, &b, timeout);
-    *data = b & (1 << bitNum);
+    int8_t count = readWord(devAddr, regAddr, &b, timeout);
+    if (count > 0) *data = b & (1 << bitNum);
     return count;
 }
 
@@ -96,16 +113,17 @@ int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16
  * @param length Number of bits to read (not more than 8)
  * @param data Container for right-aligned value (i.e. '101' read from any bitStart position will equal 0x05)
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Status of read operation (true = success)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBits(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
     // 01101001 read byte
     // 76543210 bit numbers
     //    xxx   args: bitStart=4, length=3
     //    010   masked
     //   -> 010 shifted
-    uint8_t count, b;
-    if ((count = readByte(devAddr, regAddr, &b, timeout)) != 0) {
+    int8_t count;
+    uint8_t b;
+    if ((count = readByte(devAddr, regAddr, &b, timeout)) > 0) {
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         b &= mask;
         b >>= (bitStart - length + 1);
@@ -123,15 +141,15 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
  * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
+int8_t I2Cdev::readBitsW(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
     // 1101011001101001 read byte
     // fedcba9876543210 bit numbers
     //    xxx           args: bitStart=12, length=3
     //    010           masked
     //           -> 010 shifted
-    uint8_t count;
+    int8_t count;
     uint16_t w;
-    if ((count = readWord(devAddr, regAddr, &w, timeout)) != 0) {
+    if ((count = readWord(devAddr, regAddr, &w, timeout)) > 0) {
         uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         w &= mask;
         w >>= (bitStart - length + 1);
@@ -145,9 +163,9 @@ int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uin
  * @param regAddr Register regAddr to read from
  * @param data Container for byte value read from device
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Status of read operation (true = success)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
+int8_t I2Cdev::readByte(uint16_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
     return readBytes(devAddr, regAddr, 1, data, timeout);
 }
 
@@ -156,69 +174,79 @@ int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_
  * @param regAddr Register regAddr to read from
  * @param data Container for word value read from device
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Status of read operation (true = success)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
+int8_t I2Cdev::readWord(uint16_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
     return readWords(devAddr, regAddr, 1, data, timeout);
 }
 
 /** Read multiple bytes from an 8-bit device register.
+ * The register address write and the data read are issued as one combined
+ * transaction with a repeated start, so a burst (e.g. the 14 motion registers
+ * of an MPU6050) is a single syscall and a consistent snapshot.
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
  * @param length Number of bytes to read
  * @param data Buffer to store read data in
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Number of bytes read (-1 indicates failure)
- */
-int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-    int8_t count = 0;
-    int fd = open("/dev/i2c-1", O_RDWR);
-
-    if (fd < 0) {
-        fprintf(stderr, "Failed to open device: %s\n", strerror(errno));
-        return(-1);
-    }
-    if (ioctl(fd, I2C_SLAVE, devAddr) < 0) {
-        fprintf(stderr, "Failed to select device: %s\n", strerror(errno));
-        close(fd);
-        return(-1);
-    }
-    if (write(fd, &regAddr, 1) != 1) {
-        fprintf(stderr, "Failed to write reg: %s\n", strerror(errno));
-        close(fd);
-        return(-1);
-    }
-    count = read(fd, data, length);
-    if (count < 0) {
-        fprintf(stderr, "Failed to read device(%d): %s\n", count, ::strerror(errno));
-        close(fd);
-        return(-1);
-    } else if (count != length) {
-        fprintf(stderr, "Short read  from device, expected %d, got %d\n", length, count);
-        close(fd);
-        return(-1);
-    }
-    close(fd);
-
-    return count;
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout);
+ *         not the byte count, which would not fit an int8_t beyond 127
+ */
+int8_t I2Cdev::readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+    return readBurst(devAddr, regAddr, length, data, timeout);
 }
 
 /** Read multiple words from a 16-bit device register.
+ * All words are fetched in one burst (see readBytes()) and converted from the
+ * device's big-endian byte order in place.
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
  * @param length Number of words to read
  * @param data Buffer to store read data in
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Number of words read (0 indicates failure)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout);
+ *         not the word count, which would not fit an int8_t beyond 127
  */
-int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
-    int8_t count = 0;
+int8_t I2Cdev::readWords(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
+    int8_t status = readBurst(devAddr, regAddr, length * 2, (uint8_t *)data, timeout);
 
-    printf("ReadWords() not implemented\n");
-    // Use readBytes() and potential byteswap
-    *data = 0; // keep the compiler quiet
+    if (status > 0) {
+        fromBigEndian(data, length);
+    }
+    return status;
+}
 
-    return count;
+/** Read a stream of bytes from a data port, a register that does not advance
+ * the register pointer (e.g. FIFO_R_W), in one combined transaction of any
+ * length. Unlike readBytes() a failed read is not retried, since the device
+ * may already have handed out part of the stream; the device's I2Cretry
+ * breaker still counts it.
+ * @param devAddr I2C slave device address
+ * @param regAddr Port register to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev::readPort(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    I2Cbus *bus = I2Cbus::forDevice(devAddr);
+    int8_t status;
+
+    if (bus == NULL) {
+        I2Cerrors::record(devAddr, "open", errno);
+        return 0;
+    }
+    if (!I2Cretry::admit(devAddr)) {
+        I2Cerrors::record(devAddr, "read", errno);
+        return 0;
+    }
+    status = readAttempt(bus, devAddr, regAddr, length, data, timeout, false);
+    if (status > 0) {
+        I2Cretry::succeeded(devAddr);
+    } else {
+        I2Cretry::failed(devAddr);
+    }
+    return status;
 }
 
 /** write a single bit in an 8-bit device register.
@@ -228,9 +256,9 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
  * @param value New bit value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
+bool I2Cdev::writeBit(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
     uint8_t b;
-    readByte(devAddr, regAddr, &b);
+    if (readModifyBase(devAddr, regAddr, &b) <= 0) return false;
     b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
     return writeByte(devAddr, regAddr, b);
 }
@@ -242,9 +270,9 @@ bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @param value New bit value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
+bool I2Cdev::writeBitW(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
     uint16_t w;
-    readWord(devAddr, regAddr, &w);
+    if (readModifyBaseW(devAddr, regAddr, &w) <= 0) return false;
     w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
     return writeWord(devAddr, regAddr, w);
 }
@@ -257,7 +285,7 @@ bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_
  * @param data Right-aligned value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+bool I2Cdev::writeBits(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
     //      010 value to write
     // 76543210 bit numbers
     //    xxx   args: bitStart=4, length=3
@@ -265,17 +293,8 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
     // 10101111 original value (sample)
     // 10100011 original & ~mask
     // 10101011 masked | value
-    uint8_t b;
-    if (readByte(devAddr, regAddr, &b) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        b &= ~(mask); // zero all important bits in existing byte
-        b |= data; // combine data with existing byte
-        return writeByte(devAddr, regAddr, b);
-    } else {
-        return false;
-    }
+    uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    return writeMasked(devAddr, regAddr, mask, data << (bitStart - length + 1));
 }
 
 /** Write multiple bits in a 16-bit device register.
@@ -286,7 +305,7 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  * @param data Right-aligned value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
+bool I2Cdev::writeBitsW(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
     //              010 value to write
     // fedcba9876543210 bit numbers
     //    xxx           args: bitStart=12, length=3
@@ -295,8 +314,8 @@ bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
     // 1010001110010110 original & ~mask
     // 1010101110010110 masked | value
     uint16_t w;
-    if (readWord(devAddr, regAddr, &w) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    if (readModifyBaseW(devAddr, regAddr, &w) > 0) {
+        uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         data <<= (bitStart - length + 1); // shift data into correct position
         data &= mask; // zero all non-important bits in data
         w &= ~(mask); // zero all important bits in existing word
@@ -307,13 +326,30 @@ bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
     }
 }
 
+/** Replace the masked bits of an 8-bit device register.
+ * The register is read (or taken from I2Ccache) and written back with the
+ * masked bits replaced; a full mask skips the read and writes data directly.
+ * This is what I2Cfield accessors compile down to, with mask a constant.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to replace
+ * @param data New bit values, in place (bits outside mask are ignored)
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeMasked(uint16_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data) {
+    uint8_t b;
+    if (mask == 0xFF) return writeByte(devAddr, regAddr, data);
+    if (readModifyBase(devAddr, regAddr, &b) <= 0) return false;
+    return writeByte(devAddr, regAddr, (b & ~mask) | (data & mask));
+}
+
 /** Write single byte to an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param data New byte value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
+bool I2Cdev::writeByte(uint16_t devAddr, uint8_t regAddr, uint8_t data) {
     return writeBytes(devAddr, regAddr, 1, &data);
 }
 
@@ -323,101 +359,436 @@ bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  * @param data New word value to write
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
+bool I2Cdev::writeWord(uint16_t devAddr, uint8_t regAddr, uint16_t data) {
     return writeWords(devAddr, regAddr, 1, &data);
 }
 
 /** Write multiple bytes to an 8-bit device register.
+ * The data is sent straight from the caller's buffer (see writeSegments()).
  * @param devAddr I2C slave device address
  * @param regAddr First register address to write to
  * @param length Number of bytes to write
  * @param data Buffer to copy new data from
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
-    int8_t count = 0;
-    uint8_t buf[128];
-    int fd;
+bool I2Cdev::writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
+    struct iovec segment;
 
-    if (length > 127) {
-        fprintf(stderr, "Byte write count (%d) > 127\n", length);
-        return(FALSE);
+    segment.iov_base = data;
+    segment.iov_len = length;
+    return writeSegments(devAddr, regAddr, &segment, 1);
+}
+
+/** Write multiple words to a 16-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of words to write
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeWords(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
+    uint8_t buf[255 * 2];
+    struct iovec segment;
+    int i;
+
+    // the device wants big-endian words; swap into a copy, not the caller's buffer
+    for (i = 0; i < length; i++) {
+        buf[i*2] = data[i] >> 8;
+        buf[i*2+1] = data[i];
     }
+    segment.iov_base = buf;
+    segment.iov_len = length * 2;
+    return writeSegments(devAddr, regAddr, &segment, 1);
+}
 
-    fd = open("/dev/i2c-1", O_RDWR);
-    if (fd < 0) {
-        fprintf(stderr, "Failed to open device: %s\n", strerror(errno));
-        return(FALSE);
+/** Set an absolute deadline for every following transfer on this thread.
+ * Each read or write is then bounded by whichever is sooner, its own timeout
+ * or the deadline, and fails immediately with the timeout status (errno set
+ * to ETIMEDOUT) once the deadline has passed, without touching the bus. This
+ * lets a control loop bound the worst-case time it spends on I2C per cycle.
+ * The deadline is also the time the thread's transfers are due when waiting
+ * for the bus (see I2Cbus::setDue()).
+ * @param deadline CLOCK_MONOTONIC time in nanoseconds, 0 to clear
+ */
+void I2Cdev::setDeadline(uint64_t deadline) {
+    callDeadline = deadline;
+    I2Cbus::setDue(deadline);
+}
+
+/** Set the thread's deadline relative to now.
+ * @param ms Milliseconds from now, 0 to clear
+ * @see setDeadline()
+ */
+void I2Cdev::setDeadlineIn(uint16_t ms) {
+    setDeadline((ms == 0) ? 0 : monotonicNs() + (uint64_t)ms * 1000000ull);
+}
+
+/** Get the thread's current deadline.
+ * @return CLOCK_MONOTONIC time in nanoseconds, 0 if none is set
+ */
+uint64_t I2Cdev::getDeadline() {
+    return callDeadline;
+}
+
+/** Program the adapter timeout for one transfer.
+ * @param bus Bus the transfer will run on
+ * @param timeout Per-call timeout in milliseconds (0 = none)
+ * @return Effective time budget in milliseconds (0 = unbounded), or -1 if
+ *         the thread's deadline has already passed
+ */
+int32_t I2Cdev::startTimeout(I2Cbus *bus, uint16_t timeout) {
+    int32_t budget = timeout;
+
+    if (callDeadline != 0) {
+        uint64_t now = monotonicNs();
+        if (now >= callDeadline) {
+            errno = ETIMEDOUT;
+            return -1;
+        }
+        uint64_t left = (callDeadline - now + 999999) / 1000000;
+        // the adapter timeout is a uint16_t; a farther deadline is unbounded
+        // for one transfer anyway
+        if (left > UINT16_MAX) left = UINT16_MAX;
+        if (budget == 0 || left < (uint64_t)budget) budget = left;
     }
-    if (ioctl(fd, I2C_SLAVE, devAddr) < 0) {
-        fprintf(stderr, "Failed to select device: %s\n", strerror(errno));
-        close(fd);
-        return(FALSE);
+    if (budget > 0) {
+        // no retries while bounded, they would multiply the kernel timeout
+        bus->setRetries(0);
+        bus->setTimeout(budget);
+    } else {
+        bus->setRetries(I2CBUS_DEFAULT_RETRIES);
+        bus->setTimeout(I2CBUS_DEFAULT_TIMEOUT);
     }
-    buf[0] = regAddr;
-    memcpy(buf+1,data,length);
-    count = write(fd, buf, length+1);
-    if (count < 0) {
-        fprintf(stderr, "Failed to write device(%d): %s\n", count, ::strerror(errno));
-        close(fd);
-        return(FALSE);
-    } else if (count != length+1) {
-        fprintf(stderr, "Short write to device, expected %d, got %d\n", length+1, count);
-        close(fd);
-        return(FALSE);
+    return budget;
+}
+
+/** Decide whether a failed transfer failed because it ran out of time.
+ * @param started monotonicNs() when the transfer was started
+ * @param budget Value returned by startTimeout()
+ * @return True if the transfer timed out (errno is set to ETIMEDOUT)
+ */
+bool I2Cdev::timedOut(uint64_t started, int32_t budget) {
+    if (errno == ETIMEDOUT) return true;
+    if (budget > 0 && monotonicNs() - started >= (uint64_t)budget * 1000000ull) {
+        errno = ETIMEDOUT;
+        return true;
     }
-    close(fd);
+    return false;
+}
 
-    return TRUE;
+/** Read a register burst, from this tick's snapshot if the device has read
+ * coalescing enabled (see I2Ccoalesce), from the bus otherwise.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @param timeout Read timeout in milliseconds (0 to disable)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev::readBurst(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    uint8_t burst[256];
+    uint8_t burstReg;
+    uint16_t burstLength;
+    int8_t status;
+
+    if (!I2Ccoalesce::enabled(devAddr)) {
+        return readDirect(devAddr, regAddr, length, data, timeout);
+    }
+    if (I2Ccoalesce::lookup(devAddr, regAddr, length, data, &burstReg, &burstLength)) {
+        return 1;
+    }
+    if (burstLength > sizeof(burst)) {
+        return readDirect(devAddr, regAddr, length, data, timeout);
+    }
+    if ((status = readDirect(devAddr, burstReg, burstLength, burst, timeout)) > 0) {
+        I2Ccoalesce::fill(devAddr, burstReg, burstLength, burst);
+        memcpy(data, burst + (regAddr - burstReg), length);
+    }
+    return status;
 }
 
-/** Write multiple words to a 16-bit device register.
+/** Read a register burst of any length in one combined transaction,
+ * retried as the device's I2Cretry policy says.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @param timeout Read timeout in milliseconds (0 to disable)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev::readDirect(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    I2Cbus *bus = I2Cbus::forDevice(devAddr);
+    int8_t status;
+
+    if (bus == NULL) {
+        I2Cerrors::record(devAddr, "open", errno);
+        return 0;
+    }
+    if (!I2Cretry::admit(devAddr)) {
+        I2Cerrors::record(devAddr, "read", errno);
+        return 0;
+    }
+    for (uint8_t attempt = 0; (status = readAttempt(bus, devAddr, regAddr, length, data, timeout, true)) == 0 &&
+        I2Cretry::again(devAddr, attempt, errno, callDeadline); attempt++);
+    if (status > 0) {
+        I2Cretry::succeeded(devAddr);
+    } else {
+        I2Cretry::failed(devAddr);
+    }
+    return status;
+}
+
+/** One bus attempt of readDirect() or readPort().
+ * @param increment False for a data port, whose bytes must not be fetched
+ *        twice; the register write is then marked I2CTRANSPORT_M_ONCE
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev::readAttempt(I2Cbus *bus, uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data,
+        uint16_t timeout, bool increment) {
+    struct i2c_msg msgs[2];
+    uint64_t started;
+    int32_t budget;
+
+    std::lock_guard<I2Cbus> guard(*bus);
+    if ((budget = startTimeout(bus, timeout)) < 0) {
+        I2Cerrors::record(devAddr, "read", errno);
+        return -1;
+    }
+    msgs[0].addr = I2CBUS_SLAVE(devAddr);
+    msgs[0].flags = increment ? 0 : I2CTRANSPORT_M_ONCE;
+    msgs[0].len = 1;
+    msgs[0].buf = &regAddr;
+    msgs[1].addr = I2CBUS_SLAVE(devAddr);
+    msgs[1].flags = I2C_M_RD;
+    msgs[1].len = length;
+    msgs[1].buf = data;
+    started = monotonicNs();
+    int transferred = bus->transfer(msgs, 2);
+    I2Cstats::record(devAddr, regAddr, transferred == 2 ? length : 0, 1, started, monotonicNs());
+    if (transferred != 2) {
+        bool late = timedOut(started, budget);
+        I2Cerrors::record(devAddr, "read", errno);
+        return late ? -1 : 0;
+    }
+    I2Ccache::update(devAddr, regAddr, length, data);
+    I2Ccache::overlay(devAddr, regAddr, length, data);
+
+    return 1;
+}
+
+/** Send one write message: the register byte, then length bytes of the
+ * payload starting skip bytes into the segments. Large payloads are gathered
+ * straight from the segments where the adapter supports I2C_M_NOSTART, all
+ * others are copied behind the register byte in a per-thread bounce buffer.
+ * A write to a data port (increment false) is marked I2CTRANSPORT_M_ONCE.
+ * The caller holds the bus lock.
+ * @return length on success, -1 on failure (errno is set)
+ */
+int I2Cdev::writeMessage(I2Cbus *bus, uint16_t devAddr, uint8_t regAddr, const struct iovec *segments,
+        int count, size_t skip, size_t length, bool increment) {
+    static thread_local uint8_t bounce[I2CDEV_MAX_MESSAGE];
+    struct i2c_msg msgs[I2CDEV_MAX_SEGMENTS + 1];
+    bool gather = length >= I2CDEV_GATHER_MIN && bus->supports(I2C_FUNC_NOSTART);
+    size_t filled = 0;
+    int n = 1;
+
+    msgs[0].addr = I2CBUS_SLAVE(devAddr);
+    msgs[0].flags = increment ? 0 : I2CTRANSPORT_M_ONCE;
+    if (gather) {
+        msgs[0].len = 1;
+        msgs[0].buf = &regAddr;
+    } else {
+        bounce[0] = regAddr;
+        msgs[0].len = 1 + length;
+        msgs[0].buf = bounce;
+    }
+    for (int i = 0; i < count && filled < length; i++) {
+        const uint8_t *base = (const uint8_t *)segments[i].iov_base;
+        size_t len = segments[i].iov_len;
+
+        if (skip >= len) {
+            skip -= len;
+            continue;
+        }
+        base += skip;
+        len -= skip;
+        skip = 0;
+        if (len > length - filled) len = length - filled;
+        if (gather) {
+            // continues the register byte's message: no start, no address
+            msgs[n].addr = I2CBUS_SLAVE(devAddr);
+            msgs[n].flags = I2C_M_NOSTART;
+            msgs[n].len = len;
+            msgs[n].buf = (uint8_t *)base;
+            n++;
+        } else {
+            memcpy(bounce + 1 + filled, base, len);
+        }
+        filled += len;
+    }
+    int transferred = bus->transfer(msgs, n);
+    if (transferred != n) {
+        if (transferred >= 0) errno = EIO;
+        return -1;
+    }
+    return length;
+}
+
+/** Write a payload given as separate segments, e.g. a header and a body,
+ * without first copying it behind the register byte. Payloads longer than
+ * one message (I2CDEV_MAX_MESSAGE, register byte included) are split into
+ * several writes, each starting with the register its first byte goes to:
+ * regAddr plus the offset for auto-incrementing registers, regAddr itself for
+ * data ports such as FIFO_R_W or MEM_R_W. In the bulk priority class the
+ * pieces are at most I2CBUS_BULK_CHUNK bytes and the bus is given up between
+ * them, so urgent transfers wait for one piece at most. Only the thread's
+ * deadline, if one is set, bounds the write. In I2Ccache write-back mode a
+ * single-segment write to cacheable registers only goes into the shadow
+ * registers. Failed register writes are retried as the device's I2Cretry
+ * policy says; writes to ports are not.
  * @param devAddr I2C slave device address
  * @param regAddr First register address to write to
- * @param length Number of words to write
- * @param data Buffer to copy new data from
- * @return Status of operation (true = success)
+ * @param segments Payload pieces, in order (not modified)
+ * @param count Number of segments (1 to I2CDEV_MAX_SEGMENTS)
+ * @param increment True if the device advances its register pointer per byte
+ * @return Status of operation (true = success, errno is ETIMEDOUT on timeout)
  */
-bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
-    int8_t count = 0;
-    uint8_t buf[128];
-    int i, fd;
+bool I2Cdev::writeSegments(uint16_t devAddr, uint8_t regAddr, const struct iovec *segments, int count, bool increment) {
+    I2Cbus *bus;
+    size_t total = 0, offset = 0, length, piece = I2CDEV_MAX_MESSAGE - 1;
+    int8_t status;
+
+    if (count < 1 || count > I2CDEV_MAX_SEGMENTS) {
+        errno = EINVAL;
+        I2Cerrors::record(devAddr, "write", errno);
+        return false;
+    }
+    for (int i = 0; i < count; i++) total += segments[i].iov_len;
 
-    // Should do potential byteswap and call writeBytes() really, but that
-    // messes with the callers buffer
+    I2Ccoalesce::invalidate(devAddr, regAddr, increment ? total : 1);
+    if (count == 1 && increment &&
+            I2Ccache::buffer(devAddr, regAddr, total, (const uint8_t *)segments[0].iov_base)) {
+        return true;    // write-back: goes out with the next flush
+    }
+    if (!I2Ccache::flush(devAddr)) {
+        return false;   // keep program order behind earlier buffered writes
+    }
+    bus = I2Cbus::forDevice(devAddr);
+    if (bus == NULL) {
+        I2Cerrors::record(devAddr, "open", errno);
+        return false;
+    }
+    if (!I2Cretry::admit(devAddr)) {
+        I2Cerrors::record(devAddr, "write", errno);
+        return false;
+    }
+    if (I2Cbus::getPriority() == I2CBUS_PRIORITY_BULK) piece = I2CBUS_BULK_CHUNK;
+    do {
+        uint8_t reg = increment ? regAddr + offset : regAddr;
+        length = total - offset;
+        if (length > piece) length = piece;
+        // a port (increment false) may have taken part of a failed write
+        // already, so only register writes are retried
+        for (uint8_t attempt = 0; (status = writeAttempt(bus, devAddr, reg, segments, count, offset, length, increment)) == 0 &&
+            increment && I2Cretry::again(devAddr, attempt, errno, callDeadline); attempt++);
+        if (status <= 0) {
+            I2Cretry::failed(devAddr);
+            return false;
+        }
+        offset += length;
+    } while (offset < total);
+    I2Cretry::succeeded(devAddr);
+
+    if (increment) {
+        for (int i = 0; i < count; i++) {
+            I2Ccache::update(devAddr, regAddr, segments[i].iov_len, (const uint8_t *)segments[i].iov_base);
+            regAddr += segments[i].iov_len;
+        }
+    }
+    return true;
+}
 
-    if (length > 63) {
-        fprintf(stderr, "Word write count (%d) > 63\n", length);
-        return(FALSE);
+/** One bus attempt at one message of writeSegments().
+ * @return Status of operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev::writeAttempt(I2Cbus *bus, uint16_t devAddr, uint8_t regAddr, const struct iovec *segments,
+        int count, size_t skip, size_t length, bool increment) {
+    uint64_t started;
+    int32_t budget;
+
+    std::lock_guard<I2Cbus> guard(*bus);
+    if ((budget = startTimeout(bus, 0)) < 0) {
+        I2Cerrors::record(devAddr, "write", errno);
+        return -1;
+    }
+    started = monotonicNs();
+    int written = writeMessage(bus, devAddr, regAddr, segments, count, skip, length, increment);
+    I2Cstats::record(devAddr, regAddr, 0, written >= 0 ? length + 1 : 0, started, monotonicNs());
+    if (written < 0) {
+        bool late = timedOut(started, budget);
+        I2Cerrors::record(devAddr, "write", errno);
+        return late ? -1 : 0;
     }
+    return 1;
+}
 
-    fd = open("/dev/i2c-1", O_RDWR);
-    if (fd < 0) {
-        fprintf(stderr, "Failed to open device: %s\n", strerror(errno));
-        return(FALSE);
+/** Convert words received in big-endian (device) byte order to host order.
+ * Eight words at a time with NEON or SSE2 where the compiler targets them,
+ * the remainder (or everything, elsewhere) one word at a time.
+ * @param data Words to convert in place
+ * @param length Number of words
+ */
+void I2Cdev::fromBigEndian(uint16_t *data, uint16_t length) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint16_t i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 8 <= length; i += 8) {
+        uint8_t *p = (uint8_t *)(data + i);
+        vst1q_u8(p, vrev16q_u8(vld1q_u8(p)));
     }
-    if (ioctl(fd, I2C_SLAVE, devAddr) < 0) {
-        fprintf(stderr, "Failed to select device: %s\n", strerror(errno));
-        close(fd);
-        return(FALSE);
+#elif defined(__SSE2__)
+    for (; i + 8 <= length; i += 8) {
+        __m128i *p = (__m128i *)(data + i);
+        __m128i v = _mm_loadu_si128(p);
+        _mm_storeu_si128(p, _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
     }
-    buf[0] = regAddr;
-    for (i = 0; i < length; i++) {
-        buf[i*2+1] = data[i] >> 8;
-        buf[i*2+2] = data[i];
-    }
-    count = write(fd, buf, length*2+1);
-    if (count < 0) {
-        fprintf(stderr, "Failed to write device(%d): %s\n", count, ::strerror(errno));
-        close(fd);
-        return(FALSE);
-    } else if (count != length*2+1) {
-        fprintf(stderr, "Short write to device, expected %d, got %d\n", length+1, count);
-        close(fd);
-        return(FALSE);
-    }
-    close(fd);
-    return TRUE;
+#endif
+    for (; i < length; i++) {
+        data[i] = __builtin_bswap16(data[i]);
+    }
+#else
+    (void)data;
+    (void)length;
+#endif
+}
+
+/** Get the current value of an 8-bit register for a read-modify-write.
+ * Served from the device's shadow cache when the register is cached (see
+ * I2Ccache), otherwise read from the bus.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param data Container for byte value
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev::readModifyBase(uint16_t devAddr, uint8_t regAddr, uint8_t *data) {
+    if (I2Ccache::lookup(devAddr, regAddr, 1, data)) return 1;
+    return readByte(devAddr, regAddr, data);
+}
+
+/** Get the current value of a 16-bit register for a read-modify-write.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param data Container for word value
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ * @see readModifyBase()
+ */
+int8_t I2Cdev::readModifyBaseW(uint16_t devAddr, uint8_t regAddr, uint16_t *data) {
+    uint8_t b[2];
+    if (I2Ccache::lookup(devAddr, regAddr, 2, b)) {
+        *data = (b[0] << 8) | b[1];
+        return 1;
+    }
+    return readWord(devAddr, regAddr, data);
 }
 
 /** Default timeout value for read operations.
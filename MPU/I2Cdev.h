@@ -49,29 +49,67 @@ THE SOFTWARE.
 #define FALSE	(0==1)
 #endif
 
+#include <stdint.h>
+#include <stddef.h>
+
+#define I2CDEV_MAX_MESSAGE      8192    // bytes per i2c-dev message, register byte included
+#define I2CDEV_MAX_SEGMENTS     40      // payload pieces per writeSegments() call
+#define I2CDEV_GATHER_MIN       32      // smaller payloads are copied, not gathered
+
+class I2Cbus;
+struct iovec;
+
+// Every devAddr may carry the adapter the device sits on, built with
+// I2CBUS_ADDRESS() from I2Cbus.h; a plain 7-bit address uses /dev/i2c-1.
+// Failures are reported by return value and counted in I2Cerrors, not printed;
+// devices with an I2Cretry policy are retried and sidelined as it says.
 class I2Cdev {
     public:
         I2Cdev();
         
-        static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
-        static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
-        static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
-        static int8_t readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
-        static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
-        static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
-        static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
-        static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
-
-        static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
-        static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
-        static bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
-        static bool writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data);
-        static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data);
-        static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
-        static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
-        static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static int8_t readBit(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBitW(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBits(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBitsW(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readByte(uint16_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readWord(uint16_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readWords(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int8_t readPort(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+
+        static bool writeBit(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
+        static bool writeBitW(uint16_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
+        static bool writeBits(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
+        static bool writeBitsW(uint16_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data);
+        static bool writeMasked(uint16_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data);
+        static bool writeByte(uint16_t devAddr, uint8_t regAddr, uint8_t data);
+        static bool writeWord(uint16_t devAddr, uint8_t regAddr, uint16_t data);
+        static bool writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        static bool writeWords(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static bool writeSegments(uint16_t devAddr, uint8_t regAddr, const struct iovec *segments, int count, bool increment=true);
+
+        static void setDeadline(uint64_t deadline);
+        static void setDeadlineIn(uint16_t ms);
+        static uint64_t getDeadline();
 
         static uint16_t readTimeout;
+
+    private:
+        static int8_t readBurst(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout);
+        static int8_t readDirect(uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout);
+        static int8_t readAttempt(I2Cbus *bus, uint16_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data,
+            uint16_t timeout, bool increment);
+        static int8_t writeAttempt(I2Cbus *bus, uint16_t devAddr, uint8_t regAddr, const struct iovec *segments,
+            int count, size_t skip, size_t length, bool increment);
+        static int writeMessage(I2Cbus *bus, uint16_t devAddr, uint8_t regAddr, const struct iovec *segments,
+            int count, size_t skip, size_t length, bool increment);
+        static int32_t startTimeout(I2Cbus *bus, uint16_t timeout);
+        static bool timedOut(uint64_t started, int32_t budget);
+        static void fromBigEndian(uint16_t *data, uint16_t length);
+        static int8_t readModifyBase(uint16_t devAddr, uint8_t regAddr, uint8_t *data);
+        static int8_t readModifyBaseW(uint16_t devAddr, uint8_t regAddr, uint16_t *data);
+
+        friend class I2Ctransaction;    // bounds its ioctls with startTimeout()
 };
 
 #endif /* _I2CDEV_H_ */
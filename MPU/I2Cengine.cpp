@@ -0,0 +1,268 @@
+// I2Cdev library collection - asynchronous per-bus I2C engine
+// Runs I2Cdev register reads and writes on one worker thread per adapter.
+// Any number of threads submit requests through a lock-free queue and get
+// the result back through a callback or a std::future.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <mutex>
+#include "I2Cengine.h"
+
+static_assert(I2CENGINE_MAX_WRITE >= UINT8_MAX, "a request holds any writeBytes() payload");
+
+I2Cengine *I2Cengine::engines[I2CBUS_MAX_ADAPTERS];
+
+// Only guards engine creation and shutdown, never the request path.
+static std::mutex enginesMutex;
+static bool exitHookInstalled = false;
+
+static void fulfil(void *context, int8_t status) {
+    std::promise<int8_t> *promise = (std::promise<int8_t> *)context;
+    promise->set_value(status);
+    delete promise;
+}
+
+I2Cengine::I2Cengine(uint8_t adapter) : adapter(adapter), received(0), sleeping(0), running(false) {
+}
+
+/** Get the engine of an adapter, starting its worker thread on first use.
+ * The worker is stopped again by stop() or stopAll(); stopAll() is registered
+ * with atexit() so queued requests are finished before the process exits.
+ * @param adapter Adapter number (N in /dev/i2c-N)
+ * @return Engine, or NULL if the adapter could not be opened (errno is set)
+ */
+I2Cengine *I2Cengine::get(uint8_t adapter) {
+    // opening the bus first also orders its atexit() hook before ours, so
+    // the workers are stopped while the descriptors are still open
+    if (I2Cbus::get(adapter) == NULL) {
+        return NULL;
+    }
+    std::lock_guard<std::mutex> guard(enginesMutex);
+    if (engines[adapter] == NULL) {
+        engines[adapter] = new I2Cengine(adapter);
+    }
+    I2Cengine *engine = engines[adapter];
+    if (!engine->running.load()) {
+        char name[16];
+
+        engine->running.store(true);
+        engine->worker = std::thread(&I2Cengine::run, engine);
+        snprintf(name, sizeof(name), "i2c-%u", adapter);
+        pthread_setname_np(engine->worker.native_handle(), name);
+    }
+    if (!exitHookInstalled) {
+        atexit(stopAll);
+        exitHookInstalled = true;
+    }
+    return engine;
+}
+
+/** Stop every running engine, see stop().
+ */
+void I2Cengine::stopAll() {
+    I2Cengine *running[I2CBUS_MAX_ADAPTERS];
+
+    // join outside the lock, a completion callback may still call get()
+    {
+        std::lock_guard<std::mutex> guard(enginesMutex);
+        memcpy(running, engines, sizeof(running));
+    }
+    for (int i = 0; i < I2CBUS_MAX_ADAPTERS; i++) {
+        if (running[i] != NULL) running[i]->stop();
+    }
+}
+
+/** Queue a read of multiple bytes from an 8-bit device register.
+ * Returns at once; the read runs on the bus worker, which then calls
+ * callback. The calling thread's I2Cdev deadline, if any, and I2Cbus
+ * priority class apply.
+ * @param devAddr I2C slave device address, plain addresses mean this adapter
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in, must stay valid until the callback
+ * @param callback Completion function, runs on the worker thread (may be NULL)
+ * @param context Passed to callback unchanged
+ * @param timeout Optional read timeout in milliseconds (0 to disable)
+ * @return False if the queue is full (errno is EAGAIN), true otherwise
+ */
+bool I2Cengine::readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+        Callback callback, void *context, uint16_t timeout) {
+    Request request;
+
+    request.devAddr = fullAddress(devAddr);
+    request.regAddr = regAddr;
+    request.read = true;
+    request.length = length;
+    request.timeout = timeout;
+    request.data = data;
+    request.callback = callback;
+    request.context = context;
+    return submit(request);
+}
+
+/** Queue a write of multiple bytes to an 8-bit device register.
+ * The data is copied, so the caller's buffer may be reused immediately.
+ * @param devAddr I2C slave device address, plain addresses mean this adapter
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ * @param callback Completion function, runs on the worker thread (may be NULL)
+ * @param context Passed to callback unchanged
+ * @return False if the queue is full (errno is EAGAIN), true otherwise
+ */
+bool I2Cengine::writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data,
+        Callback callback, void *context) {
+    Request request;
+
+    request.devAddr = fullAddress(devAddr);
+    request.regAddr = regAddr;
+    request.read = false;
+    request.length = length;
+    request.timeout = 0;
+    request.data = NULL;
+    request.callback = callback;
+    request.context = context;
+    memcpy(request.payload, data, length);
+    return submit(request);
+}
+
+/** Queue a register read and get its status as a future.
+ * If the request cannot be queued the future is already resolved with 0.
+ * @see readBytes(uint16_t, uint8_t, uint8_t, uint8_t *, Callback, void *, uint16_t)
+ */
+std::future<int8_t> I2Cengine::readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+        uint16_t timeout) {
+    std::promise<int8_t> *promise = new std::promise<int8_t>();
+    std::future<int8_t> result = promise->get_future();
+
+    if (!readBytes(devAddr, regAddr, length, data, fulfil, promise, timeout)) {
+        fulfil(promise, 0);
+    }
+    return result;
+}
+
+/** Queue a register write and get its status as a future.
+ * If the request cannot be queued the future is already resolved with 0.
+ * @see writeBytes(uint16_t, uint8_t, uint8_t, const uint8_t *, Callback, void *)
+ */
+std::future<int8_t> I2Cengine::writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data) {
+    std::promise<int8_t> *promise = new std::promise<int8_t>();
+    std::future<int8_t> result = promise->get_future();
+
+    if (!writeBytes(devAddr, regAddr, length, data, fulfil, promise)) {
+        fulfil(promise, 0);
+    }
+    return result;
+}
+
+/** Finish every queued request and stop the worker thread.
+ * Requests submitted while stopping may or may not run; get() starts the
+ * worker again.
+ */
+void I2Cengine::stop() {
+    if (!running.exchange(false)) return;
+    wake();
+    if (worker.joinable()) worker.join();
+}
+
+bool I2Cengine::submit(Request &request) {
+    request.deadline = I2Cdev::getDeadline();
+    request.due = I2Cbus::dueTime();
+    request.priority = I2Cbus::getPriority();
+    if (!queue.push(request)) {
+        errno = EAGAIN;
+        return false;
+    }
+    // pairs with the fence in run(): either the worker sees the new request
+    // or we see it asleep and wake it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_relaxed) != 0) wake();
+    return true;
+}
+
+void I2Cengine::wake() {
+    if (sleeping.exchange(0) != 0) {
+        syscall(SYS_futex, (uint32_t *)&sleeping, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+}
+
+void I2Cengine::run() {
+    Request request;
+
+    for (;;) {
+        // everything submitted so far competes for the next turn on the bus
+        while (queue.pop(request)) {
+            request.sequence = received++;
+            ready.push(request);
+        }
+        if (!ready.empty()) {
+            request = ready.top();
+            ready.pop();
+            execute(request);
+            continue;
+        }
+        sleeping.store(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (queue.pop(request)) {
+            sleeping.store(0);
+            request.sequence = received++;
+            ready.push(request);
+            continue;
+        }
+        if (!running.load()) break;
+        // returns at once if a producer cleared the word after our check
+        syscall(SYS_futex, (uint32_t *)&sleeping, FUTEX_WAIT_PRIVATE, 1, NULL, NULL, 0);
+        sleeping.store(0);
+    }
+    sleeping.store(0);
+}
+
+void I2Cengine::execute(Request &request) {
+    int8_t status;
+
+    I2Cdev::setDeadline(request.deadline);
+    I2Cbus::setDue(request.due);
+    I2Cbus::setPriority(request.priority);
+    if (request.read) {
+        status = I2Cdev::readBytes(request.devAddr, request.regAddr, request.length, request.data, request.timeout);
+    } else if (I2Cdev::writeBytes(request.devAddr, request.regAddr, request.length, request.payload)) {
+        status = 1;
+    } else {
+        status = (errno == ETIMEDOUT) ? -1 : 0;
+    }
+    if (request.callback != NULL) request.callback(request.context, status);
+}
@@ -0,0 +1,119 @@
+// I2Cdev library collection - asynchronous per-bus I2C engine
+// Runs I2Cdev register reads and writes on one worker thread per adapter.
+// Any number of threads submit requests through a lock-free queue and get
+// the result back through a callback or a std::future. Queued requests run
+// earliest-due first, by the submitting thread's I2Cbus priority class or
+// deadline, rather than in submission order.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CENGINE_H_
+#define _I2CENGINE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <future>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "I2Cdev.h"
+#include "I2Cbus.h"
+#include "I2Cqueue.h"
+
+#define I2CENGINE_QUEUE_DEPTH   256 // requests in flight per bus (power of two)
+#define I2CENGINE_MAX_WRITE     255 // any uint8_t length, as I2Cdev::writeBytes() takes
+
+class I2Cengine {
+    public:
+        // Called on the bus worker thread once a request has run. status
+        // follows I2Cdev: 1 success, 0 failure, -1 timeout; errno is still
+        // set from the failed transfer.
+        typedef void (*Callback)(void *context, int8_t status);
+
+        static I2Cengine *get(uint8_t adapter=I2CBUS_DEFAULT_ADAPTER);
+        static I2Cengine *forDevice(uint16_t devAddr) { return get(I2CBUS_ADAPTER(devAddr)); }
+        static void stopAll();
+
+        bool readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+            Callback callback, void *context, uint16_t timeout=I2Cdev::readTimeout);
+        bool writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data,
+            Callback callback, void *context);
+
+        std::future<int8_t> readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data,
+            uint16_t timeout=I2Cdev::readTimeout);
+        std::future<int8_t> writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data);
+
+        void stop();
+        uint8_t number() const { return adapter; }
+
+    private:
+        struct Request {
+            uint16_t devAddr;
+            uint8_t regAddr;
+            bool read;
+            uint8_t length;
+            uint16_t timeout;
+            uint64_t deadline;  // submitter's I2Cdev deadline, 0 if none
+            uint64_t due;       // I2Cbus::dueTime() at submission
+            uint64_t sequence;  // submission order, breaks ties in due
+            uint8_t priority;   // submitter's I2Cbus priority class
+            uint8_t *data;      // read destination
+            Callback callback;
+            void *context;
+            uint8_t payload[I2CENGINE_MAX_WRITE];   // copy of the write data
+        };
+
+        // orders the ready heap: the request due first on top
+        struct Later {
+            bool operator()(const Request &a, const Request &b) const {
+                return a.due != b.due ? a.due > b.due : a.sequence > b.sequence;
+            }
+        };
+
+        I2Cengine(uint8_t adapter);
+        bool submit(Request &request);
+        void run();
+        void execute(Request &request);
+        void wake();
+
+        uint16_t fullAddress(uint16_t devAddr) const {
+            return (devAddr >> 8) ? devAddr : I2CBUS_ADDRESS(adapter, devAddr);
+        }
+
+        uint8_t adapter;
+        I2Cqueue<Request, I2CENGINE_QUEUE_DEPTH> queue;
+        std::priority_queue<Request, std::vector<Request>, Later> ready; // worker only
+        uint64_t received;                  // requests taken off the queue, worker only
+        std::atomic<uint32_t> sleeping;     // futex word: 1 while the worker waits
+        std::atomic<bool> running;
+        std::thread worker;
+
+        static I2Cengine *engines[I2CBUS_MAX_ADAPTERS];
+};
+
+#endif /* _I2CENGINE_H_ */
@@ -0,0 +1,225 @@
+// I2Cdev library collection - I2C error counters and deferred logging
+// Counts failed transfers per device and per errno with relaxed atomics, and
+// reports them from a background thread at a bounded rate, so a burst of bus
+// errors costs the failing caller a few atomic increments instead of stderr
+// writes.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <mutex>
+#include <thread>
+#include "I2Cerrors.h"
+
+// errno buckets, the last one collects everything else
+static const int kindErrno[I2CERRORS_KINDS] = {
+    EREMOTEIO,  // no ACK from the slave
+    ETIMEDOUT,  // adapter or deadline timeout
+    EAGAIN,     // arbitration lost, or queue full
+    EIO,        // bus error, short transfer
+    ENXIO,      // no such device (some adapters' NACK)
+    EBUSY,      // bus held by someone else
+    ENODEV,     // adapter gone
+    EINVAL,     // bad request
+    EOPNOTSUPP, // adapter lacks the function
+    EHOSTDOWN,  // device sidelined by its I2Cretry circuit breaker
+    0,          // other
+};
+
+std::atomic<I2Cerrors::Counters *> I2Cerrors::devices[I2CBUS_MAX_ADAPTERS * 128];
+std::atomic<bool> I2Cerrors::logging(true);
+std::atomic<bool> I2Cerrors::loggerRunning(false);
+I2Cqueue<I2Cerrors::Event, 256> *I2Cerrors::events;
+
+static std::mutex loggerMutex;
+static bool loggerStopped = false;   // at exit, never restart
+static std::thread logger;
+
+/** Count a failed transfer; called on the failing path instead of printing.
+ * Costs a few relaxed atomic operations. At most one line per device and
+ * errno bucket is queued for the logger thread every I2CERRORS_LOG_INTERVAL,
+ * carrying the number of errors since the previous line. errno is preserved.
+ * @param devAddr I2C slave device address (may carry the adapter)
+ * @param what Short static description of the operation, e.g. "read"
+ * @param err errno value of the failure
+ */
+void I2Cerrors::record(uint16_t devAddr, const char *what, int err) {
+    int savedErrno = errno;
+    Counters *c = counters(devAddr, true);
+    int kind = kindOf(err);
+
+    if (c == NULL) {
+        errno = savedErrno;
+        return;
+    }
+    uint32_t n = c->count[kind].fetch_add(1, std::memory_order_relaxed) + 1;
+    if (logging.load(std::memory_order_relaxed)) {
+        uint64_t now = monotonicNs();
+        uint64_t last = c->lastLogged[kind].load(std::memory_order_relaxed);
+        if ((last == 0 || now - last >= (uint64_t)I2CERRORS_LOG_INTERVAL * 1000000ull) &&
+                c->lastLogged[kind].compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+            Event event;
+
+            event.devAddr = I2CBUS_ADDRESS(I2CBUS_ADAPTER(devAddr), I2CBUS_SLAVE(devAddr));
+            event.kind = kind;
+            event.err = err;
+            event.what = what;
+            event.count = n;
+            event.since = n - c->logged[kind].exchange(n, std::memory_order_relaxed);
+            if (!loggerRunning.load(std::memory_order_acquire)) startLogger();
+            if (loggerRunning.load(std::memory_order_acquire)) events->push(event);
+        }
+    }
+    errno = savedErrno;
+}
+
+/** Get the number of failures of one kind on a device.
+ * @param devAddr I2C slave device address (may carry the adapter)
+ * @param err errno value; errno values without a bucket of their own share
+ *        the "other" bucket
+ * @return Failures counted since start-up or the last reset()
+ */
+uint32_t I2Cerrors::count(uint16_t devAddr, int err) {
+    Counters *c = counters(devAddr, false);
+    return c == NULL ? 0 : c->count[kindOf(err)].load(std::memory_order_relaxed);
+}
+
+/** Get the number of failures of any kind on a device.
+ * @param devAddr I2C slave device address (may carry the adapter)
+ * @return Failures counted since start-up or the last reset()
+ */
+uint64_t I2Cerrors::total(uint16_t devAddr) {
+    Counters *c = counters(devAddr, false);
+    uint64_t sum = 0;
+
+    if (c == NULL) return 0;
+    for (int k = 0; k < I2CERRORS_KINDS; k++) {
+        sum += c->count[k].load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+/** Zero every counter. Counting continues concurrently, so increments that
+ * race with the reset may survive it.
+ */
+void I2Cerrors::reset() {
+    for (int i = 0; i < I2CBUS_MAX_ADAPTERS * 128; i++) {
+        Counters *c = devices[i].load(std::memory_order_acquire);
+        if (c == NULL) continue;
+        for (int k = 0; k < I2CERRORS_KINDS; k++) {
+            c->count[k].store(0, std::memory_order_relaxed);
+            c->logged[k].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/** Print every non-zero counter, one line per device and errno bucket.
+ * @param out Stream to print to
+ */
+void I2Cerrors::dump(FILE *out) {
+    for (int i = 0; i < I2CBUS_MAX_ADAPTERS * 128; i++) {
+        Counters *c = devices[i].load(std::memory_order_acquire);
+        if (c == NULL) continue;
+        for (int k = 0; k < I2CERRORS_KINDS; k++) {
+            uint32_t n = c->count[k].load(std::memory_order_relaxed);
+            if (n == 0) continue;
+            fprintf(out, "i2c-%d 0x%02x %-24s %u\n", i / 128, i % 128,
+                kindErrno[k] ? strerror(kindErrno[k]) : "other", n);
+        }
+    }
+}
+
+/** Turn the rate-limited error log on or off; counting is unaffected.
+ * @param enabled True to log (the default)
+ */
+void I2Cerrors::setLogging(bool enabled) {
+    logging.store(enabled, std::memory_order_relaxed);
+}
+
+int I2Cerrors::kindOf(int err) {
+    for (int k = 0; k < I2CERRORS_KINDS - 1; k++) {
+        if (kindErrno[k] == err) return k;
+    }
+    return I2CERRORS_KINDS - 1;
+}
+
+I2Cerrors::Counters *I2Cerrors::counters(uint16_t devAddr, bool create) {
+    std::atomic<Counters *> &slot = devices[I2CBUS_ADAPTER(devAddr) * 128 + I2CBUS_SLAVE(devAddr)];
+    Counters *c = slot.load(std::memory_order_acquire);
+
+    if (c != NULL || !create) return c;
+    // first failure on this device: racing threads may both allocate, one wins
+    Counters *fresh = (Counters *)calloc(1, sizeof(Counters));
+    if (fresh == NULL) return NULL;
+    if (!slot.compare_exchange_strong(c, fresh, std::memory_order_acq_rel)) {
+        free(fresh);
+        return c;
+    }
+    return fresh;
+}
+
+void I2Cerrors::startLogger() {
+    std::lock_guard<std::mutex> guard(loggerMutex);
+    if (loggerRunning.load() || loggerStopped) return;
+    if (events == NULL) events = new I2Cqueue<Event, 256>();
+    loggerRunning.store(true, std::memory_order_release);
+    logger = std::thread(logLoop);
+    atexit(stopLogger);
+}
+
+void I2Cerrors::stopLogger() {
+    std::lock_guard<std::mutex> guard(loggerMutex);
+    loggerStopped = true;
+    if (!loggerRunning.exchange(false)) return;
+    if (logger.joinable()) logger.join();
+    drain();
+}
+
+void I2Cerrors::logLoop() {
+    struct timespec period = { 0, I2CERRORS_LOG_PERIOD * 1000000L };
+
+    while (loggerRunning.load()) {
+        drain();
+        nanosleep(&period, NULL);
+    }
+}
+
+void I2Cerrors::drain() {
+    Event event;
+
+    while (events->pop(event)) {
+        fprintf(stderr, "I2C %s failed on i2c-%d 0x%02x: %s (%u since last report, %u total)\n",
+            event.what, I2CBUS_ADAPTER(event.devAddr), I2CBUS_SLAVE(event.devAddr),
+            strerror(event.err), event.since, event.count);
+    }
+}
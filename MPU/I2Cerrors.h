@@ -0,0 +1,88 @@
+// I2Cdev library collection - I2C error counters and deferred logging
+// Counts failed transfers per device and per errno with relaxed atomics, and
+// reports them from a background thread at a bounded rate, so a burst of bus
+// errors costs the failing caller a few atomic increments instead of stderr
+// writes.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CERRORS_H_
+#define _I2CERRORS_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <atomic>
+#include "I2Cbus.h"
+#include "I2Cqueue.h"
+
+#define I2CERRORS_KINDS         11      // see kindOf() for the errno buckets
+#define I2CERRORS_LOG_INTERVAL  1000    // ms between log lines per device and kind
+#define I2CERRORS_LOG_PERIOD    100     // ms between logger thread wakeups
+#define I2CERRORS_NO_DEVICE     0       // counts failures not tied to a device (general call address)
+
+class I2Cerrors {
+    public:
+        static void record(uint16_t devAddr, const char *what, int err);
+
+        static uint32_t count(uint16_t devAddr, int err);
+        static uint64_t total(uint16_t devAddr);
+        static void reset();
+        static void dump(FILE *out);
+
+        static void setLogging(bool enabled);
+
+    private:
+        struct Counters {
+            std::atomic<uint32_t> count[I2CERRORS_KINDS];
+            std::atomic<uint64_t> lastLogged[I2CERRORS_KINDS];  // ns, 0 = never
+            std::atomic<uint32_t> logged[I2CERRORS_KINDS];      // count at lastLogged
+        };
+
+        struct Event {
+            uint16_t devAddr;
+            uint8_t kind;
+            int err;
+            const char *what;
+            uint32_t count;
+            uint32_t since;     // errors of this kind since the previous line
+        };
+
+        static int kindOf(int err);
+        static Counters *counters(uint16_t devAddr, bool create);
+        static void startLogger();
+        static void stopLogger();
+        static void logLoop();
+        static void drain();
+
+        static std::atomic<Counters *> devices[I2CBUS_MAX_ADAPTERS * 128];
+        static std::atomic<bool> logging;
+        static std::atomic<bool> loggerRunning;
+        static I2Cqueue<Event, 256> *events;
+};
+
+#endif /* _I2CERRORS_H_ */
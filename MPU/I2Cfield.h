@@ -0,0 +1,117 @@
+// I2Cdev library collection - compile-time register bit fields
+// Describes a bit field of an 8-bit register as a type, so its mask and shift
+// are constants folded into each accessor instead of being recomputed per call,
+// and an impossible field (wider than 8 bits, running past bit 0) is a compile
+// error rather than a silently wrong mask.
+//
+// Example:
+//     typedef I2Cfield<MPU6050_RA_GYRO_CONFIG, 4, 2> FsSel;   // bits 4..3
+//     FsSel::write(devAddr, MPU6050_GYRO_FS_2000);
+//     uint8_t b = 0x18;
+//     FsSel::extract(b);                                      // 3, at compile time
+//
+// Bit numbering is the same as I2Cdev::readBits()/writeBits(): BitStart is the
+// most significant bit of the field and Length bits run down from it.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CFIELD_H_
+#define _I2CFIELD_H_
+
+#include <stdint.h>
+#include "I2Cdev.h"
+
+/** Bits BitStart..BitStart-Length+1 of an 8-bit register whose address is
+ * only known at run time, e.g. one of several identical slave control
+ * registers.
+ */
+template <uint8_t BitStart, uint8_t Length = 1>
+struct I2Cbits {
+    static_assert(Length >= 1 && Length <= 8, "a register field is 1 to 8 bits wide");
+    static_assert(BitStart <= 7, "an 8-bit register has bits 0 to 7");
+    static_assert(BitStart + 1 >= Length, "field runs past bit 0");
+
+    static constexpr uint8_t width = Length;
+    static constexpr uint8_t shift = BitStart - Length + 1;
+    static constexpr uint8_t mask = ((1u << Length) - 1) << shift;
+
+    /** Get the right-aligned field value out of a register value.
+     * Single-bit fields give 0 or 1.
+     */
+    static constexpr uint8_t extract(uint8_t b) {
+        return (b & mask) >> shift;
+    }
+
+    /** Replace the field inside a register value.
+     * Single-bit fields are set by any non-zero data, like I2Cdev::writeBit().
+     */
+    static constexpr uint8_t insert(uint8_t b, uint8_t data) {
+        return (b & ~mask) | (Length == 1 ? (data != 0 ? mask : 0) : ((data << shift) & mask));
+    }
+
+    /** Read the field.
+     * @param devAddr I2C slave device address
+     * @param regAddr Register to read from
+     * @param data Container for the right-aligned field value
+     * @param timeout Optional read timeout in milliseconds (0 to disable)
+     * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+     */
+    static int8_t read(uint16_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout) {
+        uint8_t b;
+        int8_t count = I2Cdev::readByte(devAddr, regAddr, &b, timeout);
+        if (count > 0) *data = extract(b);
+        return count;
+    }
+
+    /** Write the field, leaving the rest of the register as it was.
+     * @param devAddr I2C slave device address
+     * @param regAddr Register to write to
+     * @param data Right-aligned field value
+     * @return Status of operation (true = success)
+     */
+    static bool write(uint16_t devAddr, uint8_t regAddr, uint8_t data) {
+        return I2Cdev::writeMasked(devAddr, regAddr, mask, insert(0, data));
+    }
+};
+
+/** A bit field at a fixed register address.
+ */
+template <uint8_t RegAddr, uint8_t BitStart, uint8_t Length = 1>
+struct I2Cfield : I2Cbits<BitStart, Length> {
+    static constexpr uint8_t reg = RegAddr;
+
+    static int8_t read(uint16_t devAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout) {
+        return I2Cbits<BitStart, Length>::read(devAddr, RegAddr, data, timeout);
+    }
+
+    static bool write(uint16_t devAddr, uint8_t data) {
+        return I2Cbits<BitStart, Length>::write(devAddr, RegAddr, data);
+    }
+};
+
+#endif /* _I2CFIELD_H_ */
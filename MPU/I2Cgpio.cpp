@@ -0,0 +1,116 @@
+// I2Cdev library collection - GPIO character device interrupt line
+// An I2Cirq on one line of /dev/gpiochipN, requested as an edge-detecting
+// input through the v2 line API.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include "I2Cgpio.h"
+
+/** Describe a line; nothing is requested until open().
+ * @param chip GPIO chip number (N in /dev/gpiochipN)
+ * @param line Line offset on the chip (the BCM GPIO number on a Pi's gpiochip0)
+ * @param rising True to count rising edges, false for falling ones
+ */
+I2Cgpio::I2Cgpio(uint8_t chip, uint32_t line, bool rising) : chip(chip), line(line), rising(rising), fd(-1),
+        seqno(0), lost(0) {
+}
+
+I2Cgpio::~I2Cgpio() {
+    close();
+}
+
+/** Request the line as an input with edge detection.
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Cgpio::open() {
+    struct gpio_v2_line_request request;
+    char path[24];
+    int chipFd;
+
+    close();
+    snprintf(path, sizeof(path), "/dev/gpiochip%u", chip);
+    if ((chipFd = ::open(path, O_RDWR | O_CLOEXEC)) < 0) return -1;
+
+    memset(&request, 0, sizeof(request));
+    request.offsets[0] = line;
+    request.num_lines = 1;
+    request.event_buffer_size = I2CGPIO_EVENT_BUFFER;
+    strncpy(request.consumer, "I2Cdev", sizeof(request.consumer) - 1);
+    request.config.flags = GPIO_V2_LINE_FLAG_INPUT |
+        (rising ? GPIO_V2_LINE_FLAG_EDGE_RISING : GPIO_V2_LINE_FLAG_EDGE_FALLING);
+    if (ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {
+        int error = errno;
+        ::close(chipFd);
+        errno = error;
+        return -1;
+    }
+    ::close(chipFd);
+
+    // wait() polls first; reads must never block
+    fd = request.fd;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    seqno = 0;
+    lost = 0;
+    return 0;
+}
+
+/** Release the line.
+ */
+void I2Cgpio::close() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    fd = -1;
+}
+
+// One read() takes every queued edge; line_seqno counts all edges the kernel
+// saw, so a jump in it is edges that did not fit the buffer.
+int I2Cgpio::readEdges(uint64_t *timestamp) {
+    struct gpio_v2_line_event events[I2CIRQ_MAX_EDGES];
+    ssize_t length = ::read(fd, events, sizeof(events));
+    int count;
+
+    if (length < 0) {
+        if (errno == EAGAIN) return 0;
+        return -1;
+    }
+    count = length / sizeof(events[0]);
+    if (count == 0) return 0;
+    if (seqno != 0 && events[0].line_seqno > seqno + 1) lost += events[0].line_seqno - seqno - 1;
+    seqno = events[count - 1].line_seqno;
+    *timestamp = events[count - 1].timestamp_ns;
+    return count;
+}
@@ -0,0 +1,66 @@
+// I2Cdev library collection - GPIO character device interrupt line
+// An I2Cirq on one line of /dev/gpiochipN, requested as an edge-detecting
+// input through the v2 line API. The kernel queues and timestamps the
+// edges, so the reader sleeps in poll() between them and none is lost while
+// it is busy. Lines of the kernel's gpio-sim module work the same way, for
+// testing without hardware.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CGPIO_H_
+#define _I2CGPIO_H_
+
+#include <stdint.h>
+#include "I2Cirq.h"
+
+#define I2CGPIO_EVENT_BUFFER    64  // edges the kernel queues for the line
+
+class I2Cgpio : public I2Cirq {
+    public:
+        I2Cgpio(uint8_t chip, uint32_t line, bool rising=true);
+        ~I2Cgpio();
+
+        int open();
+        void close();
+        int handle() const { return fd; }
+
+        uint32_t dropped() const { return lost; }
+
+    protected:
+        int readEdges(uint64_t *timestamp);
+
+    private:
+        uint8_t chip;       // N in /dev/gpiochipN
+        uint32_t line;      // line offset on the chip
+        bool rising;        // rising edges, or falling for an active-low pin
+        int fd;             // line request
+        uint32_t seqno;     // line_seqno of the last edge read
+        uint32_t lost;      // edges the kernel dropped from a full buffer
+};
+
+#endif /* _I2CGPIO_H_ */
@@ -0,0 +1,91 @@
+// I2Cdev library collection - device interrupt line interface
+// Lets a reader sleep until a device raises its interrupt pin instead of
+// polling its status registers.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include "I2Cirq.h"
+#include "I2Cbus.h"
+
+I2Cirq::I2Cirq() : pending(0), last(0), total(0) {
+}
+
+/** Sleep until the line has had a number of edges.
+ * Edges are counted from the previous wait() that returned them, so none is
+ * seen twice or missed in between, and each one wakes the caller once at
+ * most. Asking for more than one edge lets e.g. a FIFO reader wake up once
+ * per batch of samples.
+ * @param edges Number of edges to wait for (at least 1)
+ * @param timeoutMs Longest time to wait in milliseconds, -1 for no limit
+ * @return Number of edges since the last return (at least edges), 0 on
+ *         timeout, -1 on failure (errno is set)
+ */
+int I2Cirq::wait(int edges, int timeoutMs) {
+    uint64_t deadline = timeoutMs >= 0 ? monotonicNs() + (uint64_t)timeoutMs * 1000000 : 0;
+    struct pollfd pfd;
+    int taken;
+
+    if (handle() < 0) {
+        errno = EBADF;
+        return -1;
+    }
+    if (edges < 1) edges = 1;
+    pfd.fd = handle();
+    pfd.events = POLLIN;
+    while (pending < edges) {
+        int remaining = -1;
+        if (timeoutMs >= 0) {
+            uint64_t now = monotonicNs();
+            if (now >= deadline) return 0;
+            remaining = (deadline - now + 999999) / 1000000;
+        }
+        int ready = poll(&pfd, 1, remaining);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (ready == 0) continue;
+        if (pfd.revents & (POLLERR | POLLNVAL)) {
+            errno = EIO;
+            return -1;
+        }
+        if ((taken = readEdges(&last)) < 0) {
+            if (errno == EAGAIN || errno == EINTR) continue;
+            return -1;
+        }
+        pending += taken;
+        total += taken;
+    }
+    taken = pending;
+    pending = 0;
+    return taken;
+}
@@ -0,0 +1,75 @@
+// I2Cdev library collection - device interrupt line interface
+// Lets a reader sleep until a device raises its interrupt pin instead of
+// polling its status registers. The edges come from whatever watches the
+// pin: a GPIO line of the Linux GPIO character device (I2Cgpio) on the Pi,
+// or a pipe written by test code or a simulated device (I2Cpipe) anywhere
+// else.
+//
+// Example:
+//     I2Cgpio irq(0, 17);         // MPU6050 INT on GPIO17 of /dev/gpiochip0
+//     mpu.setStreamInterruptEnabled(true);
+//     mpu.startStream(0);
+//     irq.open();
+//     while (irq.wait(10, 100) >= 0) n = mpu.readStream(samples, 64);
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CIRQ_H_
+#define _I2CIRQ_H_
+
+#include <stdint.h>
+
+#define I2CIRQ_MAX_EDGES    64  // edges taken from the source per read
+
+class I2Cirq {
+    public:
+        I2Cirq();
+        virtual ~I2Cirq() {}
+
+        virtual int open() = 0;
+        virtual void close() = 0;
+        virtual int handle() const = 0;     // readable while edges are waiting, -1 if closed
+        bool isOpen() const { return handle() >= 0; }
+
+        int wait(int edges, int timeoutMs);
+        uint64_t lastEdge() const { return last; }
+        uint32_t count() const { return total; }
+
+    protected:
+        // Take the edges waiting without blocking: store the time of the
+        // newest (CLOCK_MONOTONIC ns) and return their number, 0 if there
+        // are none, or -1 with errno set.
+        virtual int readEdges(uint64_t *timestamp) = 0;
+
+    private:
+        int pending;        // edges taken but not yet returned by wait()
+        uint64_t last;
+        uint32_t total;
+};
+
+#endif /* _I2CIRQ_H_ */
@@ -0,0 +1,97 @@
+// I2Cdev library collection - Linux i2c-dev transport
+// The default I2Cbus backend: one descriptor on /dev/i2c-N per adapter.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include "I2Clinux.h"
+
+I2Clinux::I2Clinux() : fd(-1) {
+}
+
+I2Clinux::~I2Clinux() {
+    close();
+}
+
+/** Open /dev/i2c-N.
+ * @param adapter Adapter number (N in /dev/i2c-N)
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Clinux::open(uint8_t adapter) {
+    char path[20];
+
+    snprintf(path, sizeof(path), "/dev/i2c-%u", adapter);
+    fd = ::open(path, O_RDWR | O_CLOEXEC);
+    return fd < 0 ? -1 : 0;
+}
+
+void I2Clinux::close() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    fd = -1;
+}
+
+int I2Clinux::setSlave(uint8_t devAddr) {
+    return ioctl(fd, I2C_SLAVE, devAddr);
+}
+
+int I2Clinux::write(const uint8_t *buf, uint16_t length) {
+    return ::write(fd, buf, length);
+}
+
+int I2Clinux::read(uint8_t *buf, uint16_t length) {
+    return ::read(fd, buf, length);
+}
+
+int I2Clinux::transfer(struct i2c_msg *msgs, int count) {
+    struct i2c_rdwr_ioctl_data xfer;
+
+    for (int i = 0; i < count; i++) msgs[i].flags &= ~I2CTRANSPORT_M_ONCE;
+    xfer.msgs = msgs;
+    xfer.nmsgs = count;
+    return ioctl(fd, I2C_RDWR, &xfer);
+}
+
+int I2Clinux::setTimeout(int32_t ticks) {
+    return ioctl(fd, I2C_TIMEOUT, ticks);
+}
+
+int I2Clinux::setRetries(int32_t count) {
+    return ioctl(fd, I2C_RETRIES, count);
+}
+
+int I2Clinux::getFunctionality(unsigned long *funcs) {
+    return ioctl(fd, I2C_FUNCS, funcs);
+}
@@ -0,0 +1,60 @@
+// I2Cdev library collection - Linux i2c-dev transport
+// The default I2Cbus backend: one descriptor on /dev/i2c-N per adapter.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CLINUX_H_
+#define _I2CLINUX_H_
+
+#include <stdint.h>
+#include "I2Ctransport.h"
+
+class I2Clinux : public I2Ctransport {
+    public:
+        I2Clinux();
+        ~I2Clinux();
+
+        int open(uint8_t adapter);
+        void close();
+        bool isOpen() const { return fd >= 0; }
+
+        int setSlave(uint8_t devAddr);
+        int write(const uint8_t *buf, uint16_t length);
+        int read(uint8_t *buf, uint16_t length);
+        int transfer(struct i2c_msg *msgs, int count);
+        int setTimeout(int32_t ticks);
+        int setRetries(int32_t count);
+        int getFunctionality(unsigned long *funcs);
+
+        int handle() const { return fd; }
+
+    private:
+        int fd;
+};
+
+#endif /* _I2CLINUX_H_ */
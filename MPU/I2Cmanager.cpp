@@ -0,0 +1,560 @@
+// I2Cdev library collection - cross-process I2C bus manager
+// One daemon (i2cd) owns an adapter and every process on the machine submits
+// its transfers through a shared-memory request ring instead of opening
+// /dev/i2c-N itself, so no two processes ever interleave messages on the bus.
+// The daemon serves requests by priority class and round-robin between the
+// client processes inside a class, and packs consecutive requests into one
+// I2C_RDWR so a burst of small writes costs a single system call. Clients use
+// the I2Cremote transport.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <linux/i2c.h>
+#include "I2Cmanager.h"
+#include "I2Cbus.h"
+
+static_assert(I2CMANAGER_PRIORITY_HIGH == I2CBUS_PRIORITY_URGENT && I2CMANAGER_PRIORITY_BULK == I2CBUS_PRIORITY_BULK,
+    "I2Cremote sends I2Cbus classes as they are");
+
+#define I2CMANAGER_SWEEP_NS     1000000000ull   // how often slots of dead clients are reclaimed
+#define I2CMANAGER_POLL_NS      100000000       // how often a waiting client checks on the daemon
+
+static bool alive(int32_t pid) {
+    return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+// The segment is shared between processes, so the futexes must not be PRIVATE.
+static long futexWait(std::atomic<uint32_t> *word, uint32_t value, uint64_t ns) {
+    struct timespec ts = { (time_t)(ns / 1000000000ull), (long)(ns % 1000000000ull) };
+    return syscall(SYS_futex, (uint32_t *)word, FUTEX_WAIT, value, &ts, NULL, 0);
+}
+
+static void futexWake(std::atomic<uint32_t> *word) {
+    syscall(SYS_futex, (uint32_t *)word, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+
+/** Create a bus manager.
+ * @param bus Transport the requests run on, usually an I2Clinux; not owned
+ */
+I2Cmanager::I2Cmanager(I2Ctransport *bus) : bus(bus), shared(NULL), running(false), timeout(-1),
+        served(0), submitted(0) {
+    name[0] = '\0';
+    memset(admitted, 0, sizeof(admitted));
+    for (int p = 0; p < I2CMANAGER_PRIORITIES; p++) turn[p] = 0;
+}
+
+I2Cmanager::~I2Cmanager() {
+    shutdown();
+}
+
+/** Open the adapter and publish the request segment (/dev/shm/i2cd-N).
+ * A segment left behind by a daemon that has died is replaced; one whose
+ * daemon still runs makes start() fail with EBUSY.
+ * @param adapter Adapter number (N in /dev/i2c-N)
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Cmanager::start(uint8_t adapter) {
+    void *memory;
+    int fd;
+
+    snprintf(name, sizeof(name), I2CMANAGER_NAME, adapter);
+    if (bus->open(adapter) < 0) return -1;
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0660);
+    if (fd < 0 && errno == EEXIST) {
+        I2Cremote previous;
+        if (previous.open(adapter) == 0) {
+            previous.close();
+            bus->close();
+            errno = EBUSY;
+            return -1;
+        }
+        shm_unlink(name);
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0660);
+    }
+    if (fd < 0) {
+        bus->close();
+        return -1;
+    }
+    fchmod(fd, 0660);   // past the umask, so the whole i2c group can submit
+    if (ftruncate(fd, sizeof(I2CmanagerShared)) < 0 ||
+        (memory = mmap(NULL, sizeof(I2CmanagerShared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        int error = errno;
+        ::close(fd);
+        shm_unlink(name);
+        bus->close();
+        errno = error;
+        return -1;
+    }
+    ::close(fd);
+
+    shared = new (memory) I2CmanagerShared();
+    shared->version = I2CMANAGER_VERSION;
+    shared->adapter = adapter;
+    if (bus->getFunctionality(&shared->funcs) < 0) shared->funcs = 0;
+    shared->daemon.store(getpid());
+    running.store(true);
+    // clients check the magic last, so they never see a half built segment
+    std::atomic_thread_fence(std::memory_order_release);
+    shared->magic = I2CMANAGER_MAGIC;
+    return 0;
+}
+
+/** Serve requests until stop() is called, then fail whatever is still
+ * queued and remove the segment.
+ */
+void I2Cmanager::run() {
+    uint16_t batch[I2CMANAGER_MAX_MSGS];
+    uint16_t index;
+    uint64_t swept = monotonicNs();
+
+    while (shared != NULL && running.load()) {
+        while (shared->ring.pop(index)) admit(index);
+        if (next(index, false)) {
+            int count = 0;
+            int messages = 0;
+
+            // Requests that only write are packed together; one that reads
+            // ends the batch, so if the transfer fails it is the only one
+            // whose messages may not have run and retrying it alone cannot
+            // lose data a device hands out once (FIFO, interrupt status).
+            // A request that must not run twice (a data port write) is never
+            // batched, since a failed batch is run again request by request.
+            while (next(index, false)) {
+                const Request &request = admitted[index];
+                if (messages + request.count > I2CMANAGER_MAX_MSGS || (count > 0 && request.once)) break;
+                next(index, true);
+                batch[count++] = index;
+                messages += request.count;
+                if (request.once || reads(request)) break;
+            }
+            dispatch(batch, count);
+            if (monotonicNs() - swept > I2CMANAGER_SWEEP_NS) {
+                sweep();
+                swept = monotonicNs();
+            }
+            continue;
+        }
+        shared->sleeping.store(1);
+        // pairs with the fence in I2Cremote::submit(): either we see the new
+        // request or the client sees us asleep and wakes us
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (shared->ring.pop(index)) {
+            shared->sleeping.store(0);
+            admit(index);
+            continue;
+        }
+        if (!running.load()) break;
+        if (futexWait(&shared->sleeping, 1, I2CMANAGER_SWEEP_NS) < 0 && errno == ETIMEDOUT) {
+            sweep();
+            swept = monotonicNs();
+        }
+        shared->sleeping.store(0);
+    }
+    shutdown();
+}
+
+/** Make run() return; safe to call from a signal handler.
+ */
+void I2Cmanager::stop() {
+    running.store(false);
+    if (shared != NULL && shared->sleeping.exchange(0) != 0) {
+        futexWake(&shared->sleeping);
+    }
+}
+
+bool I2Cmanager::reads(const Request &request) {
+    for (int i = 0; i < request.count; i++) {
+        if (request.msgs[i].flags & I2C_M_RD) return true;
+    }
+    return false;
+}
+
+// Any process in the group can write the segment, so the request is copied
+// into daemon memory once and only the copy is checked and used.
+void I2Cmanager::admit(uint16_t index) {
+    if (index >= I2CMANAGER_SLOTS) return;  // not a slot a client can wait on
+    I2CmanagerSlot &slot = shared->slots[index];
+    Request &request = admitted[index];
+    uint32_t total = 0;
+    uint8_t priority;
+
+    if (request.queued) return;     // pushed again before it ran
+    request.count = slot.count;
+    request.timeout = slot.timeout;
+    priority = slot.priority;
+    if (request.count == 0 || request.count > I2CMANAGER_MAX_MSGS) {
+        request.count = 0;
+        complete(index, -1, EINVAL);
+        return;
+    }
+    memcpy(request.msgs, slot.msgs, request.count * sizeof(I2CmanagerMessage));
+    // nothing above may be read from the slot again after this point
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    if (request.msgs[0].flags & I2C_M_NOSTART) {
+        complete(index, -1, EINVAL);
+        return;
+    }
+    request.once = false;
+    for (int i = 0; i < request.count; i++) {
+        if ((uint32_t)request.msgs[i].offset + request.msgs[i].len > I2CMANAGER_DATA) {
+            complete(index, -1, EINVAL);
+            return;
+        }
+        if (request.msgs[i].flags & I2CTRANSPORT_M_ONCE) request.once = true;
+        total += request.msgs[i].len;
+    }
+    if (total > I2CMANAGER_DATA) {
+        complete(index, -1, EMSGSIZE);
+        return;
+    }
+    if (priority >= I2CMANAGER_PRIORITIES) priority = I2CMANAGER_PRIORITIES - 1;
+    request.queued = true;
+    pending[priority][slot.owner.load()].push_back(index);
+}
+
+/** Pick the request to run next: the highest priority class with work, and
+ * inside it the client after the one served last.
+ * @param index Slot of the request
+ * @param take True to dequeue it, false to only look
+ * @return False if nothing is queued
+ */
+bool I2Cmanager::next(uint16_t &index, bool take) {
+    for (int p = 0; p < I2CMANAGER_PRIORITIES; p++) {
+        if (pending[p].empty()) continue;
+        std::map<int32_t, std::deque<uint16_t> >::iterator client = pending[p].upper_bound(turn[p]);
+        if (client == pending[p].end()) client = pending[p].begin();
+        index = client->second.front();
+        if (take) {
+            turn[p] = client->first;
+            client->second.pop_front();
+            if (client->second.empty()) pending[p].erase(client);
+        }
+        return true;
+    }
+    return false;
+}
+
+void I2Cmanager::dispatch(uint16_t *batch, int count) {
+    int result = execute(batch, count);
+    int error = errno;
+
+    if (result >= 0 || count == 1) {
+        for (int i = 0; i < count; i++) {
+            complete(batch[i], result < 0 ? -1 : admitted[batch[i]].count, error);
+        }
+        return;
+    }
+    // Some device NACKed and I2C_RDWR does not say which: run every request
+    // on its own so only the culprit fails. The writes ahead of it may reach
+    // their devices twice, which is harmless for registers; port writes,
+    // which it would not be, are never batched (see run()).
+    for (int i = 0; i < count; i++) {
+        result = execute(&batch[i], 1);
+        complete(batch[i], result < 0 ? -1 : admitted[batch[i]].count, errno);
+    }
+}
+
+int I2Cmanager::execute(uint16_t *batch, int count) {
+    struct i2c_msg msgs[I2CMANAGER_MAX_MSGS];
+    int16_t ticks = -1;
+    int n = 0;
+
+    // run() keeps a batch within I2CMANAGER_MAX_MSGS, counted from the copies
+    for (int i = 0; i < count; i++) {
+        const Request &request = admitted[batch[i]];
+        uint8_t *data = shared->slots[batch[i]].data;
+        if (request.timeout > ticks) ticks = request.timeout;
+        for (int j = 0; j < request.count; j++, n++) {
+            msgs[n].addr = request.msgs[j].addr & 0x7F;
+            msgs[n].flags = request.msgs[j].flags & (I2C_M_RD | I2C_M_NOSTART);
+            msgs[n].len = request.msgs[j].len;
+            msgs[n].buf = data + request.msgs[j].offset;
+        }
+    }
+    // the adapter timeout is shared, so a batch gets the longest one asked for
+    if (ticks >= 0 && ticks != timeout) {
+        timeout = bus->setTimeout(ticks) < 0 ? -1 : ticks;
+    }
+    submitted++;
+    return bus->transfer(msgs, n);
+}
+
+void I2Cmanager::complete(uint16_t index, int result, int error) {
+    I2CmanagerSlot &slot = shared->slots[index];
+
+    admitted[index].queued = false;
+    slot.result = result;
+    slot.error = result < 0 ? error : 0;
+    slot.state.store(I2CMANAGER_DONE, std::memory_order_release);
+    futexWake(&slot.state);
+    served++;
+}
+
+/** Free the slots of clients that died between claiming a slot and
+ * collecting its result.
+ */
+void I2Cmanager::sweep() {
+    for (int i = 0; i < I2CMANAGER_SLOTS; i++) {
+        I2CmanagerSlot &slot = shared->slots[i];
+        int32_t owner = slot.owner.load();
+
+        if (owner == 0 || alive(owner) || slot.state.load() == I2CMANAGER_QUEUED) continue;
+        slot.state.store(I2CMANAGER_IDLE);
+        slot.owner.compare_exchange_strong(owner, 0);
+    }
+}
+
+void I2Cmanager::shutdown() {
+    uint16_t index;
+
+    if (shared == NULL) return;
+    running.store(false);
+    shared->daemon.store(0);
+    while (shared->ring.pop(index)) admit(index);
+    while (next(index, true)) complete(index, -1, ESHUTDOWN);
+    shm_unlink(name);
+    munmap(shared, sizeof(I2CmanagerShared));
+    shared = NULL;
+    bus->close();
+}
+
+/** Create a client; open() connects it to the daemon of an adapter.
+ * @param priority I2CMANAGER_PRIORITY_* class of this process's requests; a
+ * thread in a less urgent I2Cbus class (see I2Cpriority) sends its requests
+ * in that class instead
+ */
+I2Cremote::I2Cremote(uint8_t priority) : shared(NULL), priority(priority), slave(0), timeout(-1), hint(0) {
+}
+
+I2Cremote::~I2Cremote() {
+    close();
+}
+
+/** Change the priority class of later requests.
+ * @param priority I2CMANAGER_PRIORITY_*
+ */
+void I2Cremote::setPriority(uint8_t priority) {
+    this->priority = priority < I2CMANAGER_PRIORITIES ? priority : I2CMANAGER_PRIORITIES - 1;
+}
+
+/** Map the daemon's segment; fails with ENOENT when no daemon has run on the
+ * adapter and ENOTCONN when it has since stopped.
+ */
+int I2Cremote::open(uint8_t adapter) {
+    char name[32];
+    struct stat st;
+    void *memory;
+    I2CmanagerShared *segment;
+    int fd;
+
+    close();
+    snprintf(name, sizeof(name), I2CMANAGER_NAME, adapter);
+    fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) return -1;
+    if (fstat(fd, &st) < 0 || st.st_size != sizeof(I2CmanagerShared)) {
+        ::close(fd);
+        errno = EPROTO;
+        return -1;
+    }
+    memory = mmap(NULL, sizeof(I2CmanagerShared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) return -1;
+
+    segment = (I2CmanagerShared *)memory;
+    if (segment->magic != I2CMANAGER_MAGIC || segment->version != I2CMANAGER_VERSION) {
+        munmap(memory, sizeof(I2CmanagerShared));
+        errno = EPROTO;
+        return -1;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!alive(segment->daemon.load())) {
+        munmap(memory, sizeof(I2CmanagerShared));
+        errno = ENOTCONN;
+        return -1;
+    }
+    shared = segment;
+    return 0;
+}
+
+void I2Cremote::close() {
+    if (shared == NULL) return;
+    munmap(shared, sizeof(I2CmanagerShared));
+    shared = NULL;
+}
+
+int I2Cremote::setSlave(uint8_t devAddr) {
+    if (devAddr > 0x7F) {
+        errno = EINVAL;
+        return -1;
+    }
+    slave = devAddr;
+    return 0;
+}
+
+int I2Cremote::write(const uint8_t *buf, uint16_t length) {
+    struct i2c_msg msg = { slave, 0, length, (uint8_t *)buf };
+    return transfer(&msg, 1) < 0 ? -1 : length;
+}
+
+int I2Cremote::read(uint8_t *buf, uint16_t length) {
+    struct i2c_msg msg = { slave, I2C_M_RD, length, buf };
+    return transfer(&msg, 1) < 0 ? -1 : length;
+}
+
+/** Run the messages through the daemon as one request; they reach the bus
+ * back to back, possibly sharing an I2C_RDWR with other requests, and no
+ * other client's messages come between them.
+ */
+int I2Cremote::transfer(struct i2c_msg *msgs, int count) {
+    I2CmanagerSlot *slot;
+    uint32_t total = 0;
+    int result;
+
+    if (shared == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if (count < 1 || count > I2CMANAGER_MAX_MSGS) {
+        errno = EINVAL;
+        return -1;
+    }
+    for (int i = 0; i < count; i++) total += msgs[i].len;
+    if (total > I2CMANAGER_DATA) {
+        errno = EMSGSIZE;
+        return -1;
+    }
+    if ((slot = claim()) == NULL) return -1;
+
+    total = 0;
+    for (int i = 0; i < count; i++) {
+        slot->msgs[i].addr = msgs[i].addr;
+        slot->msgs[i].flags = msgs[i].flags;
+        slot->msgs[i].len = msgs[i].len;
+        slot->msgs[i].offset = total;
+        if (!(msgs[i].flags & I2C_M_RD)) memcpy(slot->data + total, msgs[i].buf, msgs[i].len);
+        total += msgs[i].len;
+    }
+    slot->count = count;
+    slot->priority = I2Cbus::getPriority() > priority ? I2Cbus::getPriority() : priority;
+    slot->timeout = timeout;
+
+    result = submit(slot);
+    if (result >= 0) {
+        for (int i = 0; i < count; i++) {
+            if (msgs[i].flags & I2C_M_RD) memcpy(msgs[i].buf, slot->data + slot->msgs[i].offset, msgs[i].len);
+        }
+    }
+    slot->state.store(I2CMANAGER_IDLE, std::memory_order_relaxed);
+    slot->owner.store(0, std::memory_order_release);
+    return result;
+}
+
+/** Remembered and sent with every request; the daemon sets the adapter to
+ * the longest timeout of the requests it submits together.
+ */
+int I2Cremote::setTimeout(int32_t ticks) {
+    timeout = ticks > INT16_MAX ? INT16_MAX : ticks;
+    return 0;
+}
+
+/** Accepted and ignored: the retry count belongs to the daemon's adapter.
+ */
+int I2Cremote::setRetries(int32_t count) {
+    (void)count;
+    return 0;
+}
+
+int I2Cremote::getFunctionality(unsigned long *funcs) {
+    if (shared == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    *funcs = shared->funcs;
+    return 0;
+}
+
+I2CmanagerSlot *I2Cremote::claim() {
+    int32_t self = getpid();
+
+    for (;;) {
+        uint32_t start = hint.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < I2CMANAGER_SLOTS; i++) {
+            uint32_t index = (start + i) & (I2CMANAGER_SLOTS - 1);
+            int32_t expected = 0;
+            if (shared->slots[index].owner.compare_exchange_strong(expected, self, std::memory_order_acquire)) {
+                hint.store(index + 1, std::memory_order_relaxed);
+                return &shared->slots[index];
+            }
+        }
+        // every slot is in flight; wait for the daemon to work some off
+        if (!alive(shared->daemon.load())) {
+            errno = ENOTCONN;
+            return NULL;
+        }
+        usleep(100);
+    }
+}
+
+int I2Cremote::submit(I2CmanagerSlot *slot) {
+    uint16_t index = slot - shared->slots;
+
+    slot->state.store(I2CMANAGER_QUEUED, std::memory_order_release);
+    if (!shared->ring.push(index)) {
+        // cannot happen: the ring has a place for every slot
+        errno = EAGAIN;
+        return -1;
+    }
+    // pairs with the fence in I2Cmanager::run()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (shared->sleeping.load(std::memory_order_relaxed) != 0 && shared->sleeping.exchange(0) != 0) {
+        futexWake(&shared->sleeping);
+    }
+    while (slot->state.load(std::memory_order_acquire) == I2CMANAGER_QUEUED) {
+        if (futexWait(&slot->state, I2CMANAGER_QUEUED, I2CMANAGER_POLL_NS) < 0 && errno == ETIMEDOUT &&
+            !alive(shared->daemon.load())) {
+            errno = ENOTCONN;
+            return -1;
+        }
+    }
+    if (slot->result < 0) errno = slot->error;
+    return slot->result;
+}
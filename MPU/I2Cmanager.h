@@ -0,0 +1,185 @@
+// I2Cdev library collection - cross-process I2C bus manager
+// One daemon (i2cd) owns an adapter and every process on the machine submits
+// its transfers through a shared-memory request ring instead of opening
+// /dev/i2c-N itself, so no two processes ever interleave messages on the bus.
+// The daemon serves requests by priority class and round-robin between the
+// client processes inside a class, and packs consecutive requests into one
+// I2C_RDWR so a burst of small writes costs a single system call. Clients use
+// the I2Cremote transport.
+//
+// Example (client side):
+//     I2Cremote remote;
+//     remote.setPriority(I2CMANAGER_PRIORITY_HIGH);
+//     I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &remote);
+//     // I2Cdev calls on /dev/i2c-1 now go through the i2cd daemon
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CMANAGER_H_
+#define _I2CMANAGER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <map>
+#include "I2Ctransport.h"
+#include "I2Cqueue.h"
+
+#define I2CMANAGER_MAGIC        0x44433249  // "I2CD"
+#define I2CMANAGER_VERSION      1
+#define I2CMANAGER_NAME         "/i2cd-%u"  // shm_open() name, %u is the adapter
+#define I2CMANAGER_SLOTS        64          // requests in flight, all clients together (power of two)
+#define I2CMANAGER_MAX_MSGS     42          // I2C_RDWR_IOCTL_MAX_MSGS, per request and per batch
+#define I2CMANAGER_DATA         8192        // payload bytes per request, I2CDEV_MAX_MESSAGE
+
+#define I2CMANAGER_PRIORITIES       3
+#define I2CMANAGER_PRIORITY_HIGH    0       // e.g. servo updates
+#define I2CMANAGER_PRIORITY_NORMAL  1
+#define I2CMANAGER_PRIORITY_BULK    2       // e.g. firmware and DMP uploads
+
+// Request slot states; the word is also the futex the client sleeps on.
+#define I2CMANAGER_IDLE     0
+#define I2CMANAGER_QUEUED   1
+#define I2CMANAGER_DONE     2
+
+struct I2CmanagerMessage {
+    uint16_t addr;          // 7-bit slave address
+    uint16_t flags;         // I2C_M_RD, I2C_M_NOSTART, I2CTRANSPORT_M_ONCE
+    uint16_t len;
+    uint16_t offset;        // into the slot's data
+};
+
+// One request: the messages of one transfer, run back to back on the bus.
+struct I2CmanagerSlot {
+    std::atomic<int32_t> owner;     // client pid, 0 while the slot is free
+    std::atomic<uint32_t> state;    // I2CMANAGER_IDLE/QUEUED/DONE
+    uint8_t priority;               // I2CMANAGER_PRIORITY_*
+    uint8_t count;                  // messages
+    int16_t timeout;                // adapter timeout in 10 ms ticks, -1 for the daemon's
+    int32_t result;                 // as I2C_RDWR: messages transferred or -1
+    int32_t error;                  // errno when result is -1
+    I2CmanagerMessage msgs[I2CMANAGER_MAX_MSGS];
+    uint8_t data[I2CMANAGER_DATA];
+};
+
+// Everything in the segment is position independent and lock free, so each
+// process may map it at its own address.
+struct I2CmanagerShared {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t adapter;
+    uint8_t reserved;
+    std::atomic<int32_t> daemon;    // daemon pid, 0 once it has shut down
+    std::atomic<uint32_t> sleeping; // futex word, 1 while the daemon waits for work
+    unsigned long funcs;            // I2C_FUNCS of the adapter
+    I2Cqueue<uint16_t, I2CMANAGER_SLOTS> ring;  // indices of queued slots
+    I2CmanagerSlot slots[I2CMANAGER_SLOTS];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<size_t>::is_always_lock_free,
+    "shared-memory atomics must be lock free");
+
+class I2Cmanager {
+    public:
+        I2Cmanager(I2Ctransport *bus);
+        ~I2Cmanager();
+
+        int start(uint8_t adapter);
+        void run();
+        void stop();
+
+        uint64_t requests() const { return served; }
+        uint64_t batches() const { return submitted; }
+
+    private:
+        // The daemon's own copy of a request's message table, taken and
+        // checked in admit(). Clients can still write the slot afterwards, so
+        // only its data is used from shared memory, inside these bounds.
+        struct Request {
+            bool queued;
+            bool once;              // a message is I2CTRANSPORT_M_ONCE: never batched
+            uint8_t count;
+            int16_t timeout;
+            I2CmanagerMessage msgs[I2CMANAGER_MAX_MSGS];
+        };
+
+        static bool reads(const Request &request);
+        void admit(uint16_t index);
+        bool next(uint16_t &index, bool take);
+        void dispatch(uint16_t *batch, int count);
+        int execute(uint16_t *batch, int count);
+        void complete(uint16_t index, int result, int error);
+        void sweep();
+        void shutdown();
+
+        I2Ctransport *bus;
+        I2CmanagerShared *shared;
+        Request admitted[I2CMANAGER_SLOTS];
+        char name[32];
+        std::atomic<bool> running;
+        int16_t timeout;            // ticks last set on the adapter, -1 if never
+        uint64_t served;
+        uint64_t submitted;         // I2C_RDWR calls
+
+        // per priority class: each client's queued slots, oldest first, and
+        // the client served last so the next one gets its turn
+        std::map<int32_t, std::deque<uint16_t> > pending[I2CMANAGER_PRIORITIES];
+        int32_t turn[I2CMANAGER_PRIORITIES];
+};
+
+class I2Cremote : public I2Ctransport {
+    public:
+        I2Cremote(uint8_t priority=I2CMANAGER_PRIORITY_NORMAL);
+        ~I2Cremote();
+
+        void setPriority(uint8_t priority);
+
+        int open(uint8_t adapter);
+        void close();
+        bool isOpen() const { return shared != NULL; }
+
+        int setSlave(uint8_t devAddr);
+        int write(const uint8_t *buf, uint16_t length);
+        int read(uint8_t *buf, uint16_t length);
+        int transfer(struct i2c_msg *msgs, int count);
+        int setTimeout(int32_t ticks);
+        int setRetries(int32_t count);
+        int getFunctionality(unsigned long *funcs);
+
+    private:
+        I2CmanagerSlot *claim();
+        int submit(I2CmanagerSlot *slot);
+
+        I2CmanagerShared *shared;
+        uint8_t priority;
+        uint8_t slave;
+        int16_t timeout;
+        std::atomic<uint32_t> hint; // where the next slot search starts
+};
+
+#endif /* _I2CMANAGER_H_ */
@@ -0,0 +1,87 @@
+// I2Cdev library collection - pipe interrupt line
+// An I2Cirq whose edges are written into a pipe by trigger(), standing in
+// for a device's interrupt pin.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include "I2Cpipe.h"
+#include "I2Cbus.h"
+
+I2Cpipe::I2Cpipe() {
+    fds[0] = fds[1] = -1;
+}
+
+I2Cpipe::~I2Cpipe() {
+    close();
+}
+
+/** Create the pipe.
+ * @return 0 on success, -1 on failure (errno is set)
+ */
+int I2Cpipe::open() {
+    close();
+    return pipe2(fds, O_NONBLOCK | O_CLOEXEC);
+}
+
+/** Close both ends of the pipe.
+ */
+void I2Cpipe::close() {
+    for (int i = 0; i < 2; i++) {
+        if (fds[i] >= 0) ::close(fds[i]);
+        fds[i] = -1;
+    }
+}
+
+/** Raise one edge, timestamped now.
+ * @return 0 on success, -1 on failure (errno is set, EAGAIN if the pipe is
+ *         full because nobody waits)
+ */
+int I2Cpipe::trigger() {
+    uint64_t now = monotonicNs();
+    // shorter than PIPE_BUF, so each edge arrives whole
+    return ::write(fds[1], &now, sizeof(now)) == sizeof(now) ? 0 : -1;
+}
+
+int I2Cpipe::readEdges(uint64_t *timestamp) {
+    uint64_t edges[I2CIRQ_MAX_EDGES];
+    ssize_t length = ::read(fds[0], edges, sizeof(edges));
+    int count;
+
+    if (length < 0) {
+        if (errno == EAGAIN) return 0;
+        return -1;
+    }
+    count = length / sizeof(edges[0]);
+    if (count > 0) *timestamp = edges[count - 1];
+    return count;
+}
@@ -0,0 +1,57 @@
+// I2Cdev library collection - pipe interrupt line
+// An I2Cirq whose edges are written into a pipe by trigger(), standing in
+// for a device's interrupt pin in tests, in benchmarks and next to simulated
+// devices. Any thread may trigger; trigger() never blocks.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CPIPE_H_
+#define _I2CPIPE_H_
+
+#include <stdint.h>
+#include "I2Cirq.h"
+
+class I2Cpipe : public I2Cirq {
+    public:
+        I2Cpipe();
+        ~I2Cpipe();
+
+        int open();
+        void close();
+        int handle() const { return fds[0]; }
+
+        int trigger();
+
+    protected:
+        int readEdges(uint64_t *timestamp);
+
+    private:
+        int fds[2];         // read end, write end
+};
+
+#endif /* _I2CPIPE_H_ */
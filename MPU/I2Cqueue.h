@@ -0,0 +1,108 @@
+// I2Cdev library collection - bounded lock-free request queue
+// Multi-producer ring buffer used to hand requests to the per-bus workers of
+// I2Cengine without a lock: producers claim a slot with one compare-and-swap,
+// the consumer never blocks a producer.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CQUEUE_H_
+#define _I2CQUEUE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/** Bounded multi-producer queue (D. Vyukov's sequence-numbered ring).
+ * Every slot carries a sequence number that tells producers and the consumer
+ * whose turn it is, so push() and pop() are wait-free when the queue is
+ * neither full nor empty and never take a lock.
+ * @tparam T Element type, copied in and out
+ * @tparam Capacity Number of slots, must be a power of two
+ */
+template <typename T, size_t Capacity>
+class I2Cqueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        I2Cqueue() : head(0), tail(0) {
+            for (size_t i = 0; i < Capacity; i++) {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /** Append an element; safe from any number of threads.
+         * @return False if the queue is full
+         */
+        bool push(const T &value) {
+            size_t pos = tail.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot &slot = slots[pos & (Capacity - 1)];
+                size_t seq = slot.sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+                if (diff == 0) {
+                    if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        slot.value = value;
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /** Remove the oldest element; only one thread may call this.
+         * @return False if the queue is empty
+         */
+        bool pop(T &value) {
+            size_t pos = head.load(std::memory_order_relaxed);
+            Slot &slot = slots[pos & (Capacity - 1)];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            if ((intptr_t)seq - (intptr_t)(pos + 1) < 0) {
+                return false;
+            }
+            value = slot.value;
+            slot.sequence.store(pos + Capacity, std::memory_order_release);
+            head.store(pos + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+    private:
+        struct Slot {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        Slot slots[Capacity];
+        alignas(64) std::atomic<size_t> head;   // consumer side
+        alignas(64) std::atomic<size_t> tail;   // producer side
+};
+
+#endif /* _I2CQUEUE_H_ */
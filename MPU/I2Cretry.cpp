@@ -0,0 +1,205 @@
+// I2Cdev library collection - retry and circuit-breaker policy
+// Opt-in per device: a failed transfer is retried a bounded number of times
+// after a jittered, exponentially growing pause, and a device whose operations
+// keep failing is sidelined for a cooldown (see I2Cretry.h).
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include "I2Cretry.h"
+
+I2Cretry::Policy *I2Cretry::policies[I2CBUS_MAX_ADAPTERS * 128];
+
+// xorshift32; only spreads out the retries of threads that failed together
+static uint32_t jitter() {
+    static thread_local uint32_t state = 0;
+
+    if (state == 0) state = (uint32_t)monotonicNs() | 1;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// Failures worth another attempt: the device or bus may answer next time.
+static bool transient(int err) {
+    return err == EREMOTEIO || err == ENXIO || err == EIO || err == EAGAIN || err == EBUSY;
+}
+
+/** Retry a device's failed transfers and sideline it when it keeps failing.
+ * Calling it again replaces the policy's settings and closes the breaker.
+ * Like I2Ccache::enable(), not to be called while other threads are using
+ * the device.
+ * @param devAddr I2C slave device address
+ * @param retries Further attempts after a failed one (0 for the breaker only)
+ * @param backoffUs Pause before the first retry; each further one doubles it,
+ *        up to I2CRETRY_BACKOFF_MAX_US, and the actual pause is a random
+ *        point in the upper half of that
+ * @param threshold Operations failed in a row (after their retries) that
+ *        sideline the device, 0 for never
+ * @param cooldownMs How long the device stays sidelined
+ */
+void I2Cretry::enable(uint16_t devAddr, uint8_t retries, uint16_t backoffUs, uint8_t threshold,
+        uint16_t cooldownMs) {
+    Policy *entry = policy(devAddr);
+
+    if (entry == NULL) {
+        entry = new Policy();
+        entry->tripCount.store(0);
+    }
+    entry->retries = retries;
+    entry->threshold = threshold;
+    entry->backoffNs = backoffUs * 1000u;
+    entry->cooldownNs = cooldownMs * 1000000ull;
+    entry->failures.store(0);
+    entry->openUntil.store(0);
+    entry->probing.store(false);
+    policy(devAddr) = entry;
+}
+
+/** Go back to single attempts and no breaker for a device.
+ * @param devAddr I2C slave device address
+ */
+void I2Cretry::disable(uint16_t devAddr) {
+    delete policy(devAddr);
+    policy(devAddr) = NULL;
+}
+
+/** Check whether a device is sidelined.
+ * @param devAddr I2C slave device address
+ * @return True while the breaker is open or a probe is out
+ */
+bool I2Cretry::tripped(uint16_t devAddr) {
+    Policy *entry = policy(devAddr);
+    return entry != NULL && entry->openUntil.load() != 0;
+}
+
+/** Get how often a device has been sidelined.
+ * @param devAddr I2C slave device address
+ * @return Number of times the breaker opened, probes that failed included
+ */
+uint32_t I2Cretry::trips(uint16_t devAddr) {
+    Policy *entry = policy(devAddr);
+    return entry == NULL ? 0 : entry->tripCount.load();
+}
+
+/** Put a sidelined device back in service at once, e.g. after the caller
+ * has power-cycled it.
+ * @param devAddr I2C slave device address
+ */
+void I2Cretry::reset(uint16_t devAddr) {
+    Policy *entry = policy(devAddr);
+    if (entry == NULL) return;
+    entry->failures.store(0);
+    entry->openUntil.store(0);
+    entry->probing.store(false);
+}
+
+/** Decide whether an operation may go to the bus. Used by I2Cdev.
+ * @param devAddr I2C slave device address
+ * @return False, with errno set to EHOSTDOWN, while the device is sidelined
+ */
+bool I2Cretry::admit(uint16_t devAddr) {
+    Policy *entry = policy(devAddr);
+    uint64_t until;
+
+    if (entry == NULL || (until = entry->openUntil.load()) == 0) return true;
+    // once the cooldown is over, exactly one operation goes out as a probe;
+    // whatever becomes of it, the caller reports succeeded() or failed()
+    if (monotonicNs() >= until && !entry->probing.exchange(true)) return true;
+    errno = EHOSTDOWN;
+    return false;
+}
+
+/** Decide whether to retry a failed attempt, and wait before it. Used by
+ * I2Cdev, with the bus released. errno is left alone.
+ * @param devAddr I2C slave device address
+ * @param attempt Attempts failed so far, minus one
+ * @param err errno of the failed attempt
+ * @param deadline The thread's I2Cdev deadline (ns), 0 if none; no retry
+ *        is made that could not start before it
+ * @return True to try again
+ */
+bool I2Cretry::again(uint16_t devAddr, uint8_t attempt, int err, uint64_t deadline) {
+    Policy *entry = policy(devAddr);
+    uint64_t ceiling, pause;
+
+    if (entry == NULL || attempt >= entry->retries || !transient(err) || entry->probing.load()) {
+        return false;
+    }
+    ceiling = (uint64_t)entry->backoffNs << (attempt < 16 ? attempt : 16);
+    if (ceiling > I2CRETRY_BACKOFF_MAX_US * 1000ull) ceiling = I2CRETRY_BACKOFF_MAX_US * 1000ull;
+    // "equal jitter": never less than half the ceiling, so a retry storm
+    // still backs off, but spread out so failing threads don't retry in step
+    pause = ceiling / 2 + jitter() % (ceiling / 2 + 1);
+    if (deadline != 0 && monotonicNs() + pause >= deadline) return false;
+    if (pause > 0) {
+        struct timespec ts = { (time_t)(pause / 1000000000ull), (long)(pause % 1000000000ull) };
+        int saved = errno;
+        while (nanosleep(&ts, &ts) < 0 && errno == EINTR);
+        errno = saved;
+    }
+    return true;
+}
+
+/** Note a successful operation: the device is back in service.
+ * @param devAddr I2C slave device address
+ */
+void I2Cretry::succeeded(uint16_t devAddr) {
+    Policy *entry = policy(devAddr);
+    if (entry == NULL) return;
+    if (entry->failures.load(std::memory_order_relaxed) != 0) entry->failures.store(0);
+    if (entry->openUntil.load(std::memory_order_relaxed) != 0) {
+        entry->openUntil.store(0);
+        entry->probing.store(false);
+    }
+}
+
+/** Note an operation that failed after its retries or timed out. Also
+ * ends a probe, so it must be called for every admitted operation that did
+ * not succeed.
+ * @param devAddr I2C slave device address
+ */
+void I2Cretry::failed(uint16_t devAddr) {
+    Policy *entry = policy(devAddr);
+    if (entry == NULL) return;
+    if (entry->probing.load()) {
+        trip(entry);
+    } else if (entry->threshold != 0 && entry->failures.fetch_add(1) + 1 >= entry->threshold) {
+        trip(entry);
+    }
+}
+
+void I2Cretry::trip(Policy *entry) {
+    entry->failures.store(0);
+    entry->openUntil.store(monotonicNs() + entry->cooldownNs);
+    entry->probing.store(false);
+    entry->tripCount.fetch_add(1);
+}
@@ -0,0 +1,97 @@
+// I2Cdev library collection - retry and circuit-breaker policy
+// Opt-in per device: a failed transfer is retried a bounded number of times
+// after a jittered, exponentially growing pause (with the bus released, so
+// other devices get it meanwhile), and a device whose operations keep failing
+// is sidelined for a cooldown: its transfers fail at once with EHOSTDOWN
+// instead of spending bus time on timeouts and NACKs. After the cooldown one
+// operation is let through as a probe; success puts the device back in
+// service, failure sidelines it again.
+//
+// Reads are retried whole, so a device whose FIFO or memory port must not be
+// read twice should get retries=0 and only the breaker. Writes to such ports
+// (I2Cdev::writeSegments() with increment=false) are never retried.
+//
+// Example:
+//     I2Cretry::enable(0x40);     // PCA9685: 3 retries, breaker after 5 failures
+//     ...
+//     if (I2Cretry::tripped(0x40)) puts("servo board sidelined");
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CRETRY_H_
+#define _I2CRETRY_H_
+
+#include <stdint.h>
+#include <atomic>
+#include "I2Cbus.h"
+
+#define I2CRETRY_RETRIES        3       // further attempts after a failed one
+#define I2CRETRY_BACKOFF_US     250     // pause before the first retry, doubled for each further one
+#define I2CRETRY_BACKOFF_MAX_US 8000    // longest pause
+#define I2CRETRY_THRESHOLD      5       // operations failed in a row that open the breaker
+#define I2CRETRY_COOLDOWN_MS    2000    // how long an open breaker sidelines the device
+
+class I2Cretry {
+    public:
+        static void enable(uint16_t devAddr, uint8_t retries=I2CRETRY_RETRIES,
+            uint16_t backoffUs=I2CRETRY_BACKOFF_US, uint8_t threshold=I2CRETRY_THRESHOLD,
+            uint16_t cooldownMs=I2CRETRY_COOLDOWN_MS);
+        static void disable(uint16_t devAddr);
+        static bool enabled(uint16_t devAddr) { return policy(devAddr) != NULL; }
+        static bool tripped(uint16_t devAddr);
+        static uint32_t trips(uint16_t devAddr);
+        static void reset(uint16_t devAddr);
+
+        static bool admit(uint16_t devAddr);
+        static bool again(uint16_t devAddr, uint8_t attempt, int err, uint64_t deadline);
+        static void succeeded(uint16_t devAddr);
+        static void failed(uint16_t devAddr);
+
+    private:
+        struct Policy {
+            uint8_t retries;
+            uint8_t threshold;
+            uint32_t backoffNs;
+            uint64_t cooldownNs;
+            std::atomic<uint32_t> failures;     // operations failed in a row
+            std::atomic<uint64_t> openUntil;    // ns, 0 while the breaker is closed
+            std::atomic<bool> probing;          // the one operation let through after the cooldown
+            std::atomic<uint32_t> tripCount;
+        };
+
+        static void trip(Policy *entry);
+
+        // One slot per (adapter, 7-bit address); see I2CBUS_ADDRESS()
+        static Policy *&policy(uint16_t devAddr) {
+            return policies[I2CBUS_ADAPTER(devAddr) * 128 + I2CBUS_SLAVE(devAddr)];
+        }
+
+        static Policy *policies[I2CBUS_MAX_ADAPTERS * 128];
+};
+
+#endif /* _I2CRETRY_H_ */
@@ -0,0 +1,380 @@
+// I2Cdev library collection - single-producer sample ring
+// Hands fixed-size records, e.g. MPU6050sample, from an acquisition thread
+// to one consumer (logging, fusion, control) without a lock. The producer
+// never waits: when the consumer falls a whole ring behind, new records are
+// dropped and counted, and the gap shows in their sequence numbers. Records
+// are published and consumed in batches, so each side touches the other's
+// cache line once per batch, not once per record. Give every consumer its
+// own ring and have the acquisition thread write each batch to all of them.
+//
+// How an empty ring is waited for is a policy: I2CringSpin busy-waits
+// (lowest latency, one core), I2CringFutex sleeps in the kernel and is only
+// woken when the consumer really sleeps, and I2CringEventfd does the same
+// through an eventfd the consumer can also poll() with other descriptors.
+//
+// Example:
+//     I2Cring<MPU6050sample, 1024> ring;           // I2CringFutex
+//     // acquisition thread
+//     n = mpu.readStream(samples, 64);
+//     ring.write(samples, n);
+//     // consumer thread
+//     if (ring.wait(100) > 0) n = ring.read(batch, 64);
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CRING_H_
+#define _I2CRING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <atomic>
+#include <type_traits>
+#include "I2Cbus.h"
+
+#define I2CRING_CACHE_LINE  64
+#define I2CRING_SPINS       256 // polls of the ring before a sleeping policy sleeps
+
+static inline void I2CringRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+/** Wait policy that polls the ring until it has records; notify() is free.
+ * Meant for a consumer with a core of its own.
+ */
+class I2CringSpin {
+    public:
+        void notify() {}
+
+        template <typename Ready>
+        bool wait(const Ready &ready, int timeoutMs) {
+            uint64_t deadline = timeoutMs >= 0 ? monotonicNs() + (uint64_t)timeoutMs * 1000000 : 0;
+            for (unsigned spins = 0; !ready(); spins++) {
+                if ((spins & 1023) == 1023) {
+                    // now and then: read the clock, and let a producer on the same core run
+                    if (timeoutMs >= 0 && monotonicNs() >= deadline) return false;
+                    sched_yield();
+                }
+                I2CringRelax();
+            }
+            return true;
+        }
+
+        int handle() const { return -1; }
+        bool arm() { return true; }
+};
+
+/** What the sleeping wait policies share. The consumer announces that it is
+ * about to sleep; the producer makes a system call only then, so a busy
+ * consumer costs the producer one fence and one load per batch.
+ * @tparam Self The policy, which provides sleep(ns) and wake()
+ */
+template <typename Self>
+class I2CringSleeper {
+    public:
+        I2CringSleeper() : sleeping(0) {}
+
+        void notify() {
+            // pairs with the fence in arm(): either the consumer sees the
+            // new records or we see it asleep and wake it
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleeping.load(std::memory_order_relaxed) != 0 && sleeping.exchange(0) != 0) {
+                static_cast<Self *>(this)->wake();
+            }
+        }
+
+        template <typename Ready>
+        bool wait(const Ready &ready, int timeoutMs) {
+            Self *self = static_cast<Self *>(this);
+            uint64_t deadline = timeoutMs >= 0 ? monotonicNs() + (uint64_t)timeoutMs * 1000000 : 0;
+
+            for (unsigned spins = 0; spins < I2CRING_SPINS; spins++) {
+                if (ready()) return true;
+                I2CringRelax();
+            }
+            for (;;) {
+                self->arm();
+                if (ready()) {
+                    sleeping.store(0, std::memory_order_relaxed);
+                    return true;
+                }
+                uint64_t now = monotonicNs();
+                if (timeoutMs >= 0 && now >= deadline) {
+                    sleeping.store(0, std::memory_order_relaxed);
+                    return false;
+                }
+                self->sleep(timeoutMs >= 0 ? deadline - now : 0);
+                sleeping.store(0, std::memory_order_relaxed);
+                if (ready()) return true;
+            }
+        }
+
+        /** Announce a sleep; the caller checks the ring once more before it
+         * really sleeps.
+         */
+        bool arm() {
+            sleeping.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return true;
+        }
+
+    protected:
+        std::atomic<uint32_t> sleeping;     // 1 while the consumer is (about to be) asleep
+};
+
+/** Wait policy that sleeps on a futex.
+ */
+class I2CringFutex : public I2CringSleeper<I2CringFutex> {
+    public:
+        int handle() const { return -1; }
+
+        // Block until woken or ns have passed (0 for no limit); returns at
+        // once if the producer cleared the word after arm().
+        void sleep(uint64_t ns) {
+            struct timespec ts = { (time_t)(ns / 1000000000), (long)(ns % 1000000000) };
+            syscall(SYS_futex, (uint32_t *)&sleeping, FUTEX_WAIT_PRIVATE, 1, ns != 0 ? &ts : NULL, NULL, 0);
+        }
+
+        void wake() {
+            syscall(SYS_futex, (uint32_t *)&sleeping, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        }
+};
+
+/** Wait policy that sleeps on an eventfd, for consumers that also wait for
+ * other descriptors: call arm(), then poll() handle() for POLLIN with the
+ * rest, unless arm() said the ring already has records.
+ */
+class I2CringEventfd : public I2CringSleeper<I2CringEventfd> {
+    public:
+        I2CringEventfd() : fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+        ~I2CringEventfd() { if (fd >= 0) close(fd); }
+
+        I2CringEventfd(const I2CringEventfd &) = delete;
+        I2CringEventfd &operator=(const I2CringEventfd &) = delete;
+
+        int handle() const { return fd; }
+
+        bool arm() {
+            uint64_t count;
+            // an old wake-up would make the next poll() return at once
+            if (read(fd, &count, sizeof(count)) < 0 && errno != EAGAIN) return false;
+            return I2CringSleeper<I2CringEventfd>::arm();
+        }
+
+        void sleep(uint64_t ns) {
+            struct pollfd pfd = { fd, POLLIN, 0 };
+            poll(&pfd, 1, ns != 0 ? (int)((ns + 999999) / 1000000) : -1);
+        }
+
+        void wake() {
+            uint64_t one = 1;
+            if (write(fd, &one, sizeof(one)) < 0) return;
+        }
+
+    private:
+        int fd;
+};
+
+/** Bounded single-producer, single-consumer ring of records.
+ * Each side keeps its own index on a cache line of its own, next to a copy
+ * of the other side's index that is only refreshed when the copy says the
+ * ring is full (producer) or empty (consumer).
+ * @tparam T Record type, copied with memcpy
+ * @tparam Capacity Number of records, must be a power of two
+ * @tparam Wait I2CringSpin, I2CringFutex or I2CringEventfd
+ */
+template <typename T, size_t Capacity, typename Wait = I2CringFutex>
+class I2Cring {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "records are copied with memcpy");
+
+    public:
+        I2Cring() : tail(0), headCache(0), overruns(0), head(0), tailCache(0) {}
+
+        I2Cring(const I2Cring &) = delete;
+        I2Cring &operator=(const I2Cring &) = delete;
+
+        // ---- producer side, one thread only ----
+
+        /** Get the free slots that follow each other in memory, to fill in
+         * place and hand over with publish().
+         * @param span Set to the first free slot
+         * @return Number of free slots at span, 0 if the ring is full
+         */
+        size_t reserve(T **span) {
+            size_t free = Capacity - (tail.load(std::memory_order_relaxed) - headCache);
+            if (free == 0) {
+                headCache = head.load(std::memory_order_acquire);
+                free = Capacity - (tail.load(std::memory_order_relaxed) - headCache);
+            }
+            size_t index = tail.load(std::memory_order_relaxed) & (Capacity - 1);
+            *span = &slots[index];
+            return free < Capacity - index ? free : Capacity - index;
+        }
+
+        /** Hand records filled in after reserve() to the consumer, and wake
+         * it if it sleeps.
+         * @param count Number of records, at most what reserve() returned
+         */
+        void publish(size_t count) {
+            if (count == 0) return;
+            tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+            waiter.notify();
+        }
+
+        /** Copy records in and publish them together. Never waits: records
+         * that do not fit are dropped and counted in dropped().
+         * @param items Records to append, oldest first
+         * @param count Number of records
+         * @return Number of records appended
+         */
+        size_t write(const T *items, size_t count) {
+            size_t pos = tail.load(std::memory_order_relaxed);
+            size_t free = Capacity - (pos - headCache);
+            if (free < count) {
+                headCache = head.load(std::memory_order_acquire);
+                free = Capacity - (pos - headCache);
+            }
+            size_t n = count < free ? count : free;
+            size_t index = pos & (Capacity - 1);
+            size_t first = n < Capacity - index ? n : Capacity - index;
+
+            if (n < count) overruns.fetch_add(count - n, std::memory_order_relaxed);
+            if (n == 0) return 0;
+            memcpy(&slots[index], items, first * sizeof(T));
+            memcpy(&slots[0], items + first, (n - first) * sizeof(T));
+            publish(n);
+            return n;
+        }
+
+        bool push(const T &item) { return write(&item, 1) == 1; }
+
+        // ---- consumer side, one thread only ----
+
+        /** Get the waiting records that follow each other in memory, to use
+         * in place and release with consume().
+         * @param span Set to the oldest record
+         * @return Number of records at span, 0 if the ring is empty
+         */
+        size_t peek(const T **span) {
+            size_t ready = tailCache - head.load(std::memory_order_relaxed);
+            if (ready == 0) {
+                tailCache = tail.load(std::memory_order_acquire);
+                ready = tailCache - head.load(std::memory_order_relaxed);
+            }
+            size_t index = head.load(std::memory_order_relaxed) & (Capacity - 1);
+            *span = &slots[index];
+            return ready < Capacity - index ? ready : Capacity - index;
+        }
+
+        /** Give slots read after peek() back to the producer.
+         * @param count Number of records, at most what peek() returned
+         */
+        void consume(size_t count) {
+            head.store(head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+        }
+
+        /** Copy the oldest records out and release their slots together.
+         * @param items Array to store the records in, oldest first
+         * @param count Size of the array
+         * @return Number of records copied, 0 if the ring is empty
+         */
+        size_t read(T *items, size_t count) {
+            size_t pos = head.load(std::memory_order_relaxed);
+            size_t ready = tailCache - pos;
+            if (ready < count) {
+                tailCache = tail.load(std::memory_order_acquire);
+                ready = tailCache - pos;
+            }
+            size_t n = count < ready ? count : ready;
+            size_t index = pos & (Capacity - 1);
+            size_t first = n < Capacity - index ? n : Capacity - index;
+
+            if (n == 0) return 0;
+            memcpy(items, &slots[index], first * sizeof(T));
+            memcpy(items + first, &slots[0], (n - first) * sizeof(T));
+            head.store(pos + n, std::memory_order_release);
+            return n;
+        }
+
+        /** Wait until records are waiting, as the Wait policy does it.
+         * @param timeoutMs Longest time to wait in milliseconds, -1 for no limit
+         * @return Number of records waiting, 0 on timeout
+         */
+        size_t wait(int timeoutMs) {
+            if (!waiter.wait([this]() { return tail.load(std::memory_order_acquire) != head.load(std::memory_order_relaxed); },
+                    timeoutMs)) {
+                return 0;
+            }
+            return size();
+        }
+
+        /** Prepare to poll() handle() (I2CringEventfd only).
+         * @return False if records are already waiting and poll() might not
+         *         wake up for them
+         */
+        bool arm() {
+            waiter.arm();
+            return tail.load(std::memory_order_acquire) == head.load(std::memory_order_relaxed);
+        }
+
+        int handle() const { return waiter.handle(); }
+
+        // ---- either side ----
+
+        size_t size() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); }
+        static constexpr size_t capacity() { return Capacity; }
+        uint64_t dropped() const { return overruns.load(std::memory_order_relaxed); }
+
+    private:
+        // producer cache line
+        alignas(I2CRING_CACHE_LINE) std::atomic<size_t> tail;
+        size_t headCache;
+        std::atomic<uint64_t> overruns;
+
+        // consumer cache line
+        alignas(I2CRING_CACHE_LINE) std::atomic<size_t> head;
+        size_t tailCache;
+
+        alignas(I2CRING_CACHE_LINE) Wait waiter;
+        alignas(I2CRING_CACHE_LINE) T slots[Capacity];
+};
+
+#endif /* _I2CRING_H_ */
@@ -0,0 +1,337 @@
+// I2Cdev library collection - bus discovery and topology cache
+// Probes every 7-bit address on a set of adapters, one thread per adapter so
+// the buses are scanned side by side, and names what answers by signature
+// registers. The result can be kept in a small text file and validated with
+// one combined transfer per adapter on later starts (see I2Cscan.h).
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <linux/i2c.h>
+#include "I2Cscan.h"
+
+#define I2CSCAN_TIMEOUT_MS  20  // per probe; an absent address NACKs at once anyway
+#define I2CSCAN_MAX_MSGS    42  // I2C_RDWR_IOCTL_MAX_MSGS
+
+// Registers read at their reset values, or that software never changes.
+static I2Cscan::Signature signatures[I2CSCAN_MAX_SIGNATURES] = {
+    { "MPU6050", 0x68, 0x69, 0x75, 0x7E, 0x68 },   // WHO_AM_I[6:1] = 0x34
+    { "PCA9685", 0x40, 0x7F, 0x05, 0xFF, 0xE0 },   // ALLCALLADR
+};
+static int signatureCount = 2;
+static std::mutex signaturesMutex;
+
+// First line of a cache file for this set of adapters, sorted and without
+// duplicates so the order they are passed in does not matter.
+static void cacheHeader(const uint8_t *adapters, int count, char *header, size_t size) {
+    std::vector<uint8_t> sorted(adapters, adapters + count);
+    size_t used;
+
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    used = snprintf(header, size, "# I2Cscan 2 adapters");
+    for (size_t i = 0; i < sorted.size() && used < size; i++) {
+        used += snprintf(header + used, size - used, " %u", sorted[i]);
+    }
+    if (used < size) snprintf(header + used, size - used, "\n");
+}
+
+/** Teach the scanner another part. Signatures are tried in the order they
+ * were added, built-in ones first, and the first match names the device.
+ * @param signature Part description; part must stay valid
+ * @return False if the table is full
+ */
+bool I2Cscan::addSignature(const Signature &signature) {
+    std::lock_guard<std::mutex> guard(signaturesMutex);
+    if (signatureCount == I2CSCAN_MAX_SIGNATURES) return false;
+    signatures[signatureCount++] = signature;
+    return true;
+}
+
+/** Probe every address from I2CSCAN_FIRST_ADDRESS to I2CSCAN_LAST_ADDRESS on
+ * each adapter, all adapters at once. An address counts as present when a
+ * one-byte read is ACKed; a present device is then identified by reading the
+ * signature registers whose address range covers it, which sets its register
+ * pointer. The probes run in the bulk priority class and take the bus one at
+ * a time, so other users of the adapter are not held off by a scan.
+ * @param adapters Adapter numbers (N in /dev/i2c-N)
+ * @param count Number of adapters
+ * @param found Set to the devices found, by adapter and address
+ * @return Number of devices found, or -1 if an adapter could not be opened
+ *         (errno is set; found still holds the other adapters' devices)
+ */
+int I2Cscan::scan(const uint8_t *adapters, int count, std::vector<Device> &found) {
+    std::vector<std::vector<Device> > results(count);
+    std::vector<int> errors(count, 0);
+    std::vector<std::thread> workers;
+
+    for (int i = 1; i < count; i++) {
+        workers.push_back(std::thread(scanAdapter, adapters[i], &results[i], &errors[i]));
+    }
+    if (count > 0) scanAdapter(adapters[0], &results[0], &errors[0]);
+    for (size_t i = 0; i < workers.size(); i++) workers[i].join();
+
+    found.clear();
+    int error = 0;
+    for (int i = 0; i < count; i++) {
+        found.insert(found.end(), results[i].begin(), results[i].end());
+        if (errors[i] != 0) error = errors[i];
+    }
+    if (error != 0) {
+        errno = error;
+        return -1;
+    }
+    return found.size();
+}
+
+/** Check that the devices of a topology are still there and still the same
+ * parts: every signature register (or, for unidentified devices, one byte)
+ * is read again, all devices of an adapter in one combined transfer.
+ * A device added since the topology was taken is not noticed, so an empty
+ * topology is never valid: there is nothing in it to check.
+ * @param devices Topology, e.g. from load()
+ * @return True if every device answered as before
+ */
+bool I2Cscan::validate(const std::vector<Device> &devices) {
+    struct i2c_msg msgs[I2CSCAN_MAX_MSGS];
+    uint8_t values[I2CSCAN_MAX_MSGS];
+    size_t first = 0;
+
+    if (devices.empty()) return false;
+    while (first < devices.size()) {
+        uint8_t adapter = I2CBUS_ADAPTER(devices[first].devAddr);
+        I2Cbus *bus = I2Cbus::get(adapter);
+        size_t last;
+        int n = 0;
+
+        if (bus == NULL) return false;
+        // one transfer per adapter, or per I2C_RDWR_IOCTL_MAX_MSGS messages
+        for (last = first; last < devices.size() && I2CBUS_ADAPTER(devices[last].devAddr) == adapter &&
+                n + 2 <= I2CSCAN_MAX_MSGS; last++) {
+            const Device &device = devices[last];
+            if (device.identified) {
+                msgs[n].addr = I2CBUS_SLAVE(device.devAddr);
+                msgs[n].flags = 0;
+                msgs[n].len = 1;
+                msgs[n].buf = (uint8_t *)&device.regAddr;
+                n++;
+            }
+            msgs[n].addr = I2CBUS_SLAVE(device.devAddr);
+            msgs[n].flags = I2C_M_RD;
+            msgs[n].len = 1;
+            msgs[n].buf = &values[last - first];
+            n++;
+        }
+        {
+            std::lock_guard<I2Cbus> guard(*bus);
+            bus->setTimeout(I2CSCAN_TIMEOUT_MS);
+            int transferred = bus->transfer(msgs, n);
+            bus->setTimeout(I2CBUS_DEFAULT_TIMEOUT);
+            if (transferred != n) return false;
+        }
+        for (size_t i = first; i < last; i++) {
+            if (devices[i].identified && values[i - first] != devices[i].value) return false;
+        }
+        first = last;
+    }
+    return true;
+}
+
+/** Write a topology to a cache file, replacing it atomically.
+ * @param path Cache file
+ * @param adapters Adapter numbers the topology was scanned on
+ * @param count Number of adapters
+ * @param devices Topology, e.g. from scan()
+ * @return False if the file could not be written (errno is set)
+ */
+bool I2Cscan::save(const char *path, const uint8_t *adapters, int count, const std::vector<Device> &devices) {
+    char temporary[256];
+    char header[128];
+    FILE *file;
+    bool status;
+
+    snprintf(temporary, sizeof(temporary), "%s.tmp", path);
+    if ((file = fopen(temporary, "w")) == NULL) return false;
+    cacheHeader(adapters, count, header, sizeof(header));
+    fputs(header, file);
+    for (size_t i = 0; i < devices.size(); i++) {
+        const Device &device = devices[i];
+        if (device.identified) {
+            fprintf(file, "%u 0x%02x %s 0x%02x 0x%02x\n", I2CBUS_ADAPTER(device.devAddr),
+                I2CBUS_SLAVE(device.devAddr), device.part, device.regAddr, device.value);
+        } else {
+            fprintf(file, "%u 0x%02x %s - -\n", I2CBUS_ADAPTER(device.devAddr),
+                I2CBUS_SLAVE(device.devAddr), device.part);
+        }
+    }
+    status = fflush(file) == 0 && ferror(file) == 0;
+    if (fclose(file) != 0) status = false;
+    if (status && rename(temporary, path) == 0) return true;
+    int error = errno;
+    remove(temporary);
+    errno = error;
+    return false;
+}
+
+/** Read a topology from a cache file written by save().
+ * @param path Cache file
+ * @param adapters Adapter numbers the topology is wanted for
+ * @param count Number of adapters
+ * @param devices Set to the topology
+ * @return False if the file is missing or malformed, or was written for
+ *         another set of adapters
+ */
+bool I2Cscan::load(const char *path, const uint8_t *adapters, int count, std::vector<Device> &devices) {
+    char line[128];
+    char header[128];
+    FILE *file;
+    bool status = true;
+
+    devices.clear();
+    if ((file = fopen(path, "r")) == NULL) return false;
+    cacheHeader(adapters, count, header, sizeof(header));
+    if (fgets(line, sizeof(line), file) == NULL || strcmp(line, header) != 0) {
+        fclose(file);
+        return false;
+    }
+    while (status && fgets(line, sizeof(line), file) != NULL) {
+        Device device;
+        unsigned adapter, slave, regAddr, value;
+        char part[I2CSCAN_PART_LENGTH];
+        int fields = sscanf(line, "%u %x %15s %x %x", &adapter, &slave, part, &regAddr, &value);
+
+        if (fields < 3 || adapter >= I2CBUS_MAX_ADAPTERS || slave > 0x7F ||
+                (fields == 5 && (regAddr > 0xFF || value > 0xFF))) {
+            status = false;
+            break;
+        }
+        device.devAddr = I2CBUS_ADDRESS(adapter, slave);
+        strcpy(device.part, part);
+        device.identified = fields == 5;
+        device.regAddr = device.identified ? regAddr : 0;
+        device.value = device.identified ? value : 0;
+        devices.push_back(device);
+    }
+    fclose(file);
+    if (!status) devices.clear();
+    return status;
+}
+
+/** Get the topology the quick way when possible: validate the cache file
+ * and use it if it was taken on the same set of adapters and every device
+ * still answers the same, otherwise scan and rewrite the file. Delete the
+ * cache when devices are added.
+ * @param path Cache file, or NULL to always scan
+ * @param adapters Adapter numbers (N in /dev/i2c-N)
+ * @param count Number of adapters
+ * @param found Set to the devices, by adapter and address
+ * @return Number of devices, or -1 if an adapter could not be opened
+ */
+int I2Cscan::discover(const char *path, const uint8_t *adapters, int count, std::vector<Device> &found) {
+    int n;
+
+    if (path != NULL && load(path, adapters, count, found) && validate(found)) return found.size();
+    n = scan(adapters, count, found);
+    if (n >= 0 && path != NULL) save(path, adapters, count, found);
+    return n;
+}
+
+void I2Cscan::scanAdapter(uint8_t adapter, std::vector<Device> *found, int *error) {
+    I2Cpriority bulk(I2CBUS_PRIORITY_BULK);
+    I2Cbus *bus = I2Cbus::get(adapter);
+
+    if (bus == NULL) {
+        *error = errno;
+        return;
+    }
+    for (uint8_t slave = I2CSCAN_FIRST_ADDRESS; slave <= I2CSCAN_LAST_ADDRESS; slave++) {
+        struct i2c_msg msg;
+        uint8_t value;
+        Device device;
+
+        msg.addr = slave;
+        msg.flags = I2C_M_RD;
+        msg.len = 1;
+        msg.buf = &value;
+        {
+            std::lock_guard<I2Cbus> guard(*bus);
+            bus->setTimeout(I2CSCAN_TIMEOUT_MS);
+            int transferred = bus->transfer(&msg, 1);
+            // the next user of the adapter gets the default back, as after
+            // I2Cdev::startTimeout() with no deadline
+            bus->setTimeout(I2CBUS_DEFAULT_TIMEOUT);
+            if (transferred != 1) continue;
+        }
+        device.devAddr = I2CBUS_ADDRESS(adapter, slave);
+        if (!identify(bus, slave, device)) {
+            strcpy(device.part, "unknown");
+            device.identified = false;
+            device.regAddr = 0;
+            device.value = 0;
+        }
+        found->push_back(device);
+    }
+}
+
+bool I2Cscan::identify(I2Cbus *bus, uint8_t slave, Device &device) {
+    std::lock_guard<std::mutex> tableGuard(signaturesMutex);
+
+    for (int i = 0; i < signatureCount; i++) {
+        const Signature &signature = signatures[i];
+        struct i2c_msg msgs[2];
+        uint8_t regAddr = signature.regAddr;
+        uint8_t value;
+
+        if (slave < signature.firstAddr || slave > signature.lastAddr) continue;
+        msgs[0].addr = slave;
+        msgs[0].flags = 0;
+        msgs[0].len = 1;
+        msgs[0].buf = &regAddr;
+        msgs[1].addr = slave;
+        msgs[1].flags = I2C_M_RD;
+        msgs[1].len = 1;
+        msgs[1].buf = &value;
+        {
+            std::lock_guard<I2Cbus> guard(*bus);
+            if (bus->transfer(msgs, 2) != 2) continue;
+        }
+        if ((value & signature.mask) != signature.value) continue;
+        snprintf(device.part, sizeof(device.part), "%s", signature.part);
+        device.identified = true;
+        device.regAddr = signature.regAddr;
+        device.value = value;
+        return true;
+    }
+    return false;
+}
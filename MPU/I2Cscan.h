@@ -0,0 +1,92 @@
+// I2Cdev library collection - bus discovery and topology cache
+// Probes every 7-bit address on a set of adapters, one thread per adapter so
+// the buses are scanned side by side, and names what answers by signature
+// registers (WHO_AM_I, mode registers at their reset values). The result can
+// be kept in a small text file; on later starts validating that file costs one
+// combined I2C_RDWR per adapter instead of a full scan.
+//
+// Example:
+//     static const uint8_t adapters[] = { 1 };
+//     std::vector<I2Cscan::Device> devices;
+//     I2Cscan::discover("/var/cache/i2c-topology", adapters, 1, devices);
+//     for (const I2Cscan::Device &d : devices) printf("%04x %s\n", d.devAddr, d.part);
+//
+// Cache file format: a "# I2Cscan 2 adapters <N> <N>..." line naming the
+// adapters scanned in ascending order, then one line per device:
+// "<adapter> 0x<address> <part> 0x<register> 0x<value>", with register and
+// value those of the matching signature ("-" for devices that only ACKed).
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CSCAN_H_
+#define _I2CSCAN_H_
+
+#include <stdint.h>
+#include <vector>
+#include "I2Cbus.h"
+
+#define I2CSCAN_FIRST_ADDRESS   0x08    // below are reserved addresses (general call, CBUS, HS mode)
+#define I2CSCAN_LAST_ADDRESS    0x77    // above are 10-bit address prefixes
+#define I2CSCAN_PART_LENGTH     16
+#define I2CSCAN_MAX_SIGNATURES  32
+
+class I2Cscan {
+    public:
+        // A part is recognized when it answers within [firstAddr, lastAddr]
+        // and (register & mask) == value.
+        struct Signature {
+            const char *part;
+            uint8_t firstAddr;
+            uint8_t lastAddr;
+            uint8_t regAddr;
+            uint8_t mask;
+            uint8_t value;
+        };
+
+        struct Device {
+            uint16_t devAddr;               // I2CBUS_ADDRESS(adapter, slave)
+            char part[I2CSCAN_PART_LENGTH]; // signature's part, "unknown" if none matched
+            bool identified;                // regAddr/value are a signature match
+            uint8_t regAddr;
+            uint8_t value;                  // register value as read, unmasked
+        };
+
+        static bool addSignature(const Signature &signature);
+
+        static int scan(const uint8_t *adapters, int count, std::vector<Device> &found);
+        static bool validate(const std::vector<Device> &devices);
+        static bool save(const char *path, const uint8_t *adapters, int count, const std::vector<Device> &devices);
+        static bool load(const char *path, const uint8_t *adapters, int count, std::vector<Device> &devices);
+        static int discover(const char *path, const uint8_t *adapters, int count, std::vector<Device> &found);
+
+    private:
+        static void scanAdapter(uint8_t adapter, std::vector<Device> *found, int *error);
+        static bool identify(I2Cbus *bus, uint8_t slave, Device &device);
+};
+
+#endif /* _I2CSCAN_H_ */
@@ -0,0 +1,274 @@
+// I2Cdev library collection - coroutine scheduler for I2C transactions
+// Lets device code be written as plain sequential functions that co_await
+// register reads and writes, while one thread multiplexes any number of them.
+// The transfers themselves run on the per-bus I2Cengine workers.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <thread>
+#include <sys/eventfd.h>
+#include "I2Cscheduler.h"
+#include "I2Cengine.h"
+#include "I2Cerrors.h"
+
+/** Hand control back when a task ends: to the task awaiting it, or, for a
+ * spawned task, to the scheduler, which destroys it.
+ */
+std::coroutine_handle<> I2Ctask::FinalAwaiter::await_suspend(handle_type h) noexcept {
+    promise_type &promise = h.promise();
+    if (promise.continuation) return promise.continuation;
+    if (promise.owner != nullptr) promise.owner->finished(h);
+    return std::noop_coroutine();
+}
+
+I2Cscheduler::I2Cscheduler() : sleeping(false), live(0) {
+    wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (wakeFd < 0) {
+        // run() still works, polling for completions, see wait()
+        I2Cerrors::record(I2CERRORS_NO_DEVICE, "scheduler event", errno);
+    }
+}
+
+/** Destroy the scheduler. Tasks still alive are leaked rather than destroyed
+ * while a transfer may still complete into their frames.
+ */
+I2Cscheduler::~I2Cscheduler() {
+    collect();
+    if (wakeFd >= 0) close(wakeFd);
+}
+
+/** Start running a task concurrently with the others.
+ * The scheduler takes ownership and destroys the task when it finishes.
+ * @param task Task to run, typically the result of calling a coroutine
+ */
+void I2Cscheduler::spawn(I2Ctask task) {
+    I2Ctask::handle_type h = task.handle;
+
+    task.handle = nullptr;
+    if (!h) return;
+    h.promise().owner = this;
+    live++;
+    ready.push_back(h);
+}
+
+/** Run tasks on the calling thread until every spawned task has finished.
+ * Between resumptions the thread sleeps until a transfer completes or the
+ * earliest delay() expires.
+ */
+void I2Cscheduler::run() {
+    std::coroutine_handle<> h;
+
+    while (live > 0) {
+        while (completions.pop(h)) ready.push_back(h);
+        uint64_t now = monotonicNs();
+        while (!timers.empty() && timers.begin()->first <= now) {
+            ready.push_back(timers.begin()->second);
+            timers.erase(timers.begin());
+        }
+        if (!ready.empty()) {
+            // only what is ready now, so I/O completions get a turn
+            for (size_t n = ready.size(); n > 0; n--) {
+                h = ready.front();
+                ready.pop_front();
+                h.resume();
+            }
+            collect();
+            continue;
+        }
+        int timeoutMs = -1;
+        if (!timers.empty()) {
+            timeoutMs = (timers.begin()->first - now + 999999) / 1000000;
+        }
+        wait(timeoutMs);
+    }
+}
+
+/** Read multiple bytes into a buffer carried by the awaitable.
+ * co_await yields an I2Cresult.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ */
+I2Cscheduler::Read I2Cscheduler::read(uint16_t devAddr, uint8_t regAddr, uint8_t length) {
+    Read op;
+
+    op.scheduler = this;
+    op.status = 0;
+    op.devAddr = devAddr;
+    op.regAddr = regAddr;
+    op.result.length = length;
+    return op;
+}
+
+/** Read multiple bytes into the caller's buffer.
+ * co_await yields the I2Cdev::readBytes() status.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ */
+I2Cscheduler::ReadInto I2Cscheduler::read(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    ReadInto op;
+
+    op.scheduler = this;
+    op.status = 0;
+    op.devAddr = devAddr;
+    op.regAddr = regAddr;
+    op.length = length;
+    op.data = data;
+    return op;
+}
+
+/** Write multiple bytes; the data is copied when the write is queued.
+ * co_await yields 1 on success, 0 on failure, -1 on timeout.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ */
+I2Cscheduler::Write I2Cscheduler::write(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data) {
+    Write op;
+
+    op.scheduler = this;
+    op.status = 0;
+    op.devAddr = devAddr;
+    op.regAddr = regAddr;
+    op.length = length;
+    op.data = data;
+    return op;
+}
+
+/** Suspend the awaiting task for a while without blocking the others.
+ * @param ms Milliseconds to wait
+ */
+I2Cscheduler::Delay I2Cscheduler::delay(uint32_t ms) {
+    Delay op;
+
+    op.scheduler = this;
+    op.wakeAt = monotonicNs() + (uint64_t)ms * 1000000ull;
+    return op;
+}
+
+void I2Cscheduler::Transfer::complete(void *context, int8_t status) {
+    Transfer *op = (Transfer *)context;
+
+    op->status = status;
+    op->scheduler->post(op->devAddr, op->awaiting);
+}
+
+bool I2Cscheduler::Read::await_suspend(std::coroutine_handle<> h) {
+    I2Cengine *engine = I2Cengine::forDevice(devAddr);
+
+    awaiting = h;
+    return engine != NULL &&
+        engine->readBytes(devAddr, regAddr, result.length, result.data, complete, (Transfer *)this);
+}
+
+bool I2Cscheduler::ReadInto::await_suspend(std::coroutine_handle<> h) {
+    I2Cengine *engine = I2Cengine::forDevice(devAddr);
+
+    awaiting = h;
+    return engine != NULL &&
+        engine->readBytes(devAddr, regAddr, length, data, complete, (Transfer *)this);
+}
+
+bool I2Cscheduler::Write::await_suspend(std::coroutine_handle<> h) {
+    I2Cengine *engine = I2Cengine::forDevice(devAddr);
+
+    awaiting = h;
+    return engine != NULL &&
+        engine->writeBytes(devAddr, regAddr, length, data, complete, (Transfer *)this);
+}
+
+void I2Cscheduler::Delay::await_suspend(std::coroutine_handle<> h) {
+    scheduler->timers.insert(std::make_pair(wakeAt, h));
+}
+
+// Called on an engine worker thread.
+void I2Cscheduler::post(uint16_t devAddr, std::coroutine_handle<> h) {
+    uint64_t one = 1;
+
+    while (!completions.push(h)) {
+        std::this_thread::yield();
+    }
+    // pairs with the fence in wait()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (wakeFd >= 0 && sleeping.load(std::memory_order_relaxed) && sleeping.exchange(false)) {
+        if (::write(wakeFd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+            I2Cerrors::record(devAddr, "scheduler wake", errno);
+        }
+    }
+}
+
+void I2Cscheduler::finished(I2Ctask::handle_type h) {
+    done.push_back(h);
+}
+
+void I2Cscheduler::collect() {
+    for (size_t i = 0; i < done.size(); i++) {
+        done[i].destroy();
+        live--;
+    }
+    done.clear();
+}
+
+void I2Cscheduler::wait(int timeoutMs) {
+    struct pollfd pfd;
+    std::coroutine_handle<> h;
+    uint64_t count;
+
+    sleeping.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (completions.pop(h)) {
+        sleeping.store(false);
+        ready.push_back(h);
+        return;
+    }
+    if (wakeFd < 0) {
+        // nothing can wake the thread, so look at the queue again soon
+        if (timeoutMs < 0 || timeoutMs > I2CSCHEDULER_POLL_MS) timeoutMs = I2CSCHEDULER_POLL_MS;
+        poll(NULL, 0, timeoutMs);
+        sleeping.store(false);
+        return;
+    }
+    pfd.fd = wakeFd;
+    pfd.events = POLLIN;
+    if (poll(&pfd, 1, timeoutMs) > 0) {
+        if (::read(wakeFd, &count, sizeof(count)) < 0 && errno != EAGAIN) {
+            I2Cerrors::record(I2CERRORS_NO_DEVICE, "scheduler event", errno);
+        }
+    }
+    sleeping.store(false);
+}
@@ -0,0 +1,202 @@
+// I2Cdev library collection - coroutine scheduler for I2C transactions
+// Lets device code be written as plain sequential functions that co_await
+// register reads and writes, while one thread multiplexes any number of them.
+// The transfers themselves run on the per-bus I2Cengine workers.
+//
+// Example:
+//     I2Cscheduler sched;
+//     I2Ctask sample(I2Cscheduler &sched, uint16_t devAddr) {
+//         for (;;) {
+//             I2Cresult r = co_await sched.read(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14);
+//             if (r.status > 0) printf("ax %d\n", r.word(0));
+//             co_await sched.delay(10);
+//         }
+//     }
+//     sched.spawn(sample(sched, 0x68));
+//     sched.run();
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CSCHEDULER_H_
+#define _I2CSCHEDULER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <map>
+#include <vector>
+#include "I2Cdev.h"
+#include "I2Cqueue.h"
+
+#define I2CSCHEDULER_MAX_PENDING    1024 // transfers in flight per scheduler (power of two)
+#define I2CSCHEDULER_POLL_MS        1    // completion check interval when no eventfd could be made
+
+class I2Cscheduler;
+
+/** Coroutine type for device code run by I2Cscheduler.
+ * A task starts suspended; hand it to I2Cscheduler::spawn() to run it
+ * concurrently, or co_await it from another task to run it to completion
+ * as a subroutine.
+ */
+class I2Ctask {
+    public:
+        struct promise_type;
+        typedef std::coroutine_handle<promise_type> handle_type;
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(handle_type h) noexcept;
+            void await_resume() noexcept {}
+        };
+
+        struct promise_type {
+            std::coroutine_handle<> continuation;   // task awaiting this one
+            I2Cscheduler *owner = nullptr;          // set by spawn()
+
+            I2Ctask get_return_object() { return I2Ctask(handle_type::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        I2Ctask(I2Ctask &&other) noexcept : handle(other.handle) { other.handle = nullptr; }
+        I2Ctask(const I2Ctask &) = delete;
+        I2Ctask &operator=(const I2Ctask &) = delete;
+        ~I2Ctask() { if (handle) handle.destroy(); }
+
+        bool await_ready() const noexcept { return !handle || handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+        void await_resume() const noexcept {}
+
+    private:
+        explicit I2Ctask(handle_type h) : handle(h) {}
+
+        handle_type handle;
+
+        friend class I2Cscheduler;
+};
+
+/** Result of a co_await'ed register read.
+ * status follows I2Cdev: > 0 success, 0 failure, -1 timeout.
+ */
+struct I2Cresult {
+    int8_t status;
+    uint8_t length;
+    uint8_t data[255];
+
+    /** Big-endian 16-bit register pair at word index i (bytes 2i, 2i+1). */
+    int16_t word(uint8_t i) const { return (int16_t)((data[i * 2] << 8) | data[i * 2 + 1]); }
+};
+
+class I2Cscheduler {
+    public:
+        // Shared part of the transfer awaitables: completes on the engine
+        // worker, resumes on the scheduler thread.
+        struct Transfer {
+            I2Cscheduler *scheduler;
+            std::coroutine_handle<> awaiting;
+            int8_t status;
+            uint16_t devAddr;
+
+            static void complete(void *context, int8_t status);
+        };
+
+        struct Read : Transfer {
+            uint8_t regAddr;
+            I2Cresult result;
+
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> h);
+            I2Cresult await_resume() { result.status = status; return result; }
+        };
+
+        struct ReadInto : Transfer {
+            uint8_t regAddr;
+            uint8_t length;
+            uint8_t *data;
+
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> h);
+            int8_t await_resume() const { return status; }
+        };
+
+        struct Write : Transfer {
+            uint8_t regAddr;
+            uint8_t length;
+            const uint8_t *data;
+
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> h);
+            int8_t await_resume() const { return status; }
+        };
+
+        struct Delay {
+            I2Cscheduler *scheduler;
+            uint64_t wakeAt;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> h);
+            void await_resume() const noexcept {}
+        };
+
+        I2Cscheduler();
+        ~I2Cscheduler();
+
+        void spawn(I2Ctask task);
+        void run();
+        int active() const { return live; }
+
+        Read read(uint16_t devAddr, uint8_t regAddr, uint8_t length);
+        ReadInto read(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        Write write(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data);
+        Delay delay(uint32_t ms);
+
+    private:
+        void post(uint16_t devAddr, std::coroutine_handle<> h);
+        void finished(I2Ctask::handle_type h);
+        void collect();
+        void wait(int timeoutMs);
+
+        std::deque<std::coroutine_handle<> > ready;
+        std::vector<I2Ctask::handle_type> done;
+        std::multimap<uint64_t, std::coroutine_handle<> > timers;
+        I2Cqueue<std::coroutine_handle<>, I2CSCHEDULER_MAX_PENDING> completions;
+        std::atomic<bool> sleeping;
+        int wakeFd;
+        int live;
+
+        friend struct I2Ctask::FinalAwaiter;
+};
+
+#endif /* _I2CSCHEDULER_H_ */
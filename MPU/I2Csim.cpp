@@ -0,0 +1,213 @@
+// I2Cdev library collection - simulated I2C bus
+// An I2Ctransport that serves transfers from in-process register-level device
+// models and charges each message a configurable bus time, so driver code can
+// be exercised and benchmarked reproducibly on a machine without I2C hardware.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <vector>
+#include <linux/i2c.h>
+#include "I2Csim.h"
+#include "I2Cbus.h"
+
+I2Cregisters::I2Cregisters() : pointer(0) {
+    memset(regs, 0, sizeof(regs));
+}
+
+int I2Cregisters::write(const uint8_t *buf, uint16_t length) {
+    if (length == 0) return 0;
+    pointer = buf[0];
+    for (uint16_t i = 1; i < length; i++) {
+        uint8_t reg = pointer;
+        writeRegister(reg, buf[i]);
+        if (autoIncrement(reg)) pointer++;
+    }
+    return length;
+}
+
+int I2Cregisters::read(uint8_t *buf, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t reg = pointer;
+        buf[i] = readRegister(reg);
+        if (autoIncrement(reg)) pointer++;
+    }
+    return length;
+}
+
+/** Create an empty simulated bus.
+ * @param byteNs Bus time per data byte in nanoseconds
+ * @param messageNs Bus time per message (start, address, stop) in nanoseconds
+ */
+I2Csim::I2Csim(uint32_t byteNs, uint32_t messageNs) : slave(0), opened(false),
+        byteNs(byteNs), messageNs(messageNs), realTime(true), busy(0) {
+    memset(models, 0, sizeof(models));
+}
+
+/** Put a device model on the bus; addresses without one NACK.
+ * The model is not owned and must outlive its use on the bus.
+ * @param devAddr 7-bit address the model answers to
+ * @param model Device model
+ */
+void I2Csim::attach(uint8_t devAddr, I2Cmodel *model) {
+    std::lock_guard<std::mutex> guard(lock);
+    models[devAddr & 0x7F] = model;
+}
+
+/** Remove the device model at an address.
+ * @param devAddr 7-bit address
+ */
+void I2Csim::detach(uint8_t devAddr) {
+    std::lock_guard<std::mutex> guard(lock);
+    models[devAddr & 0x7F] = NULL;
+}
+
+/** Change the simulated bus timing.
+ * @param byteNs Bus time per data byte in nanoseconds
+ * @param messageNs Bus time per message in nanoseconds
+ */
+void I2Csim::setLatency(uint32_t byteNs, uint32_t messageNs) {
+    std::lock_guard<std::mutex> guard(lock);
+    this->byteNs = byteNs;
+    this->messageNs = messageNs;
+}
+
+/** Choose whether transfers take their simulated bus time in wall-clock time
+ * (the default, by spinning, so throughput measurements are realistic) or
+ * return at once with the time only added to busyNs().
+ * @param enabled True to spin
+ */
+void I2Csim::setRealTime(bool enabled) {
+    realTime = enabled;
+}
+
+int I2Csim::open(uint8_t adapter) {
+    (void)adapter;
+    opened = true;
+    return 0;
+}
+
+void I2Csim::close() {
+    opened = false;
+}
+
+int I2Csim::setSlave(uint8_t devAddr) {
+    if (devAddr > 0x7F) {
+        errno = EINVAL;
+        return -1;
+    }
+    slave = devAddr;
+    return 0;
+}
+
+int I2Csim::write(const uint8_t *buf, uint16_t length) {
+    std::lock_guard<std::mutex> guard(lock);
+    I2Cmodel *model = device(slave);
+
+    charge(1, model != NULL ? length : 0);
+    return model != NULL ? model->write(buf, length) : -1;
+}
+
+int I2Csim::read(uint8_t *buf, uint16_t length) {
+    std::lock_guard<std::mutex> guard(lock);
+    I2Cmodel *model = device(slave);
+
+    charge(1, model != NULL ? length : 0);
+    return model != NULL ? model->read(buf, length) : -1;
+}
+
+/** Run messages back to back like I2C_RDWR; stops at the first NACK, with
+ * the messages before it having taken effect. Write messages flagged
+ * I2C_M_NOSTART continue the write before them, as one message on the bus.
+ */
+int I2Csim::transfer(struct i2c_msg *msgs, int count) {
+    std::lock_guard<std::mutex> guard(lock);
+    uint32_t bytes = 0;
+    int messages = 0;
+    int i, last;
+
+    for (i = 0; i < count; i = last + 1) {
+        I2Cmodel *model = device(msgs[i].addr);
+        int result;
+
+        for (last = i; last + 1 < count && (msgs[last + 1].flags & I2C_M_NOSTART) &&
+            !(msgs[last + 1].flags & I2C_M_RD); last++);
+        messages++;
+        if (model == NULL) break;
+        if (msgs[i].flags & I2C_M_RD) {
+            result = model->read(msgs[i].buf, msgs[i].len);
+        } else if (last == i) {
+            result = model->write(msgs[i].buf, msgs[i].len);
+        } else {
+            // gathered segments reach the device as one contiguous write
+            std::vector<uint8_t> joined;
+            for (int j = i; j <= last; j++) {
+                joined.insert(joined.end(), msgs[j].buf, msgs[j].buf + msgs[j].len);
+            }
+            result = model->write(joined.data(), joined.size());
+        }
+        if (result < 0) break;
+        for (int j = i; j <= last; j++) bytes += msgs[j].len;
+    }
+    charge(messages, bytes);
+    return i < count ? -1 : count;
+}
+
+int I2Csim::setTimeout(int32_t ticks) {
+    (void)ticks;
+    return 0;
+}
+
+int I2Csim::setRetries(int32_t count) {
+    (void)count;
+    return 0;
+}
+
+int I2Csim::getFunctionality(unsigned long *funcs) {
+    *funcs = I2C_FUNC_I2C | I2C_FUNC_NOSTART;
+    return 0;
+}
+
+I2Cmodel *I2Csim::device(uint8_t devAddr) {
+    I2Cmodel *model = models[devAddr & 0x7F];
+    if (model == NULL) errno = EREMOTEIO;
+    return model;
+}
+
+void I2Csim::charge(int messages, uint32_t bytes) {
+    uint64_t ns = (uint64_t)messages * messageNs + (uint64_t)bytes * byteNs;
+    uint64_t until;
+
+    busy.fetch_add(ns, std::memory_order_relaxed);
+    if (!realTime || ns == 0) return;
+    until = monotonicNs() + ns;
+    while (monotonicNs() < until);
+}
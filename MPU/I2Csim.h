@@ -0,0 +1,123 @@
+// I2Cdev library collection - simulated I2C bus
+// An I2Ctransport that serves transfers from in-process register-level device
+// models and charges each message a configurable bus time, so driver code can
+// be exercised and benchmarked reproducibly on a machine without I2C hardware.
+//
+// Example:
+//     I2Csim sim;
+//     MPU6050sim mpu;
+//     sim.attach(MPU6050_DEFAULT_ADDRESS, &mpu);
+//     I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &sim);
+//     // MPU6050 and I2Cdev calls on /dev/i2c-1 now talk to the model
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CSIM_H_
+#define _I2CSIM_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include "I2Ctransport.h"
+
+#define I2CSIM_BYTE_NS      22500   // 9 clocks per byte at 400 kHz
+#define I2CSIM_MESSAGE_NS   25000   // start/stop and the address byte
+
+/** A device on the simulated bus. Each call is one I2C message addressed to
+ * the device; the return value is the number of bytes transferred, or -1
+ * with errno set to NACK the message.
+ */
+class I2Cmodel {
+    public:
+        virtual ~I2Cmodel() {}
+
+        virtual int write(const uint8_t *buf, uint16_t length) = 0;
+        virtual int read(uint8_t *buf, uint16_t length) = 0;
+};
+
+/** A device with the usual register pointer protocol: the first byte of a
+ * write selects a register, following bytes are written from there on and
+ * reads continue from the pointer, which advances after every byte unless
+ * autoIncrement() says otherwise (FIFO and memory ports).
+ */
+class I2Cregisters : public I2Cmodel {
+    public:
+        I2Cregisters();
+
+        int write(const uint8_t *buf, uint16_t length);
+        int read(uint8_t *buf, uint16_t length);
+
+        uint8_t peek(uint8_t reg) const { return regs[reg]; }
+        void poke(uint8_t reg, uint8_t value) { regs[reg] = value; }
+
+    protected:
+        virtual uint8_t readRegister(uint8_t reg) { return regs[reg]; }
+        virtual void writeRegister(uint8_t reg, uint8_t value) { regs[reg] = value; }
+        virtual bool autoIncrement(uint8_t reg) { (void)reg; return true; }
+
+        uint8_t regs[256];
+        uint8_t pointer;
+};
+
+class I2Csim : public I2Ctransport {
+    public:
+        I2Csim(uint32_t byteNs=I2CSIM_BYTE_NS, uint32_t messageNs=I2CSIM_MESSAGE_NS);
+
+        void attach(uint8_t devAddr, I2Cmodel *model);
+        void detach(uint8_t devAddr);
+        void setLatency(uint32_t byteNs, uint32_t messageNs);
+        void setRealTime(bool enabled);
+        uint64_t busyNs() const { return busy.load(std::memory_order_relaxed); }
+
+        int open(uint8_t adapter);
+        void close();
+        bool isOpen() const { return opened; }
+
+        int setSlave(uint8_t devAddr);
+        int write(const uint8_t *buf, uint16_t length);
+        int read(uint8_t *buf, uint16_t length);
+        int transfer(struct i2c_msg *msgs, int count);
+        int setTimeout(int32_t ticks);
+        int setRetries(int32_t count);
+        int getFunctionality(unsigned long *funcs);
+
+    private:
+        I2Cmodel *device(uint8_t devAddr);
+        void charge(int messages, uint32_t bytes);
+
+        I2Cmodel *models[128];
+        uint8_t slave;
+        bool opened;
+        uint32_t byteNs;
+        uint32_t messageNs;
+        bool realTime;      // spin for the simulated bus time, not only count it
+        std::atomic<uint64_t> busy;
+        std::mutex lock;    // one transfer at a time, like an adapter
+};
+
+#endif /* _I2CSIM_H_ */
@@ -0,0 +1,262 @@
+// I2Cdev library collection - I2C transfer latency and bus utilization
+// Records the duration of every transfer in lock-free log-linear histograms,
+// per device and per range of 16 registers, together with bytes moved and the
+// time each adapter spent busy, so the calls that dominate a bus can be found
+// at runtime.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "I2Cstats.h"
+
+#define SUB_COUNT   (1 << I2CSTATS_SUB_BITS)
+
+std::atomic<I2Cstats::Device *> I2Cstats::devices[I2CBUS_MAX_ADAPTERS * 128];
+I2Cstats::Bus I2Cstats::buses[I2CBUS_MAX_ADAPTERS];
+std::atomic<uint64_t> I2Cstats::since(0);
+std::atomic<bool> I2Cstats::active(true);
+
+/** Account one transfer; called by I2Cdev and I2Ctransaction after each one.
+ * Lock-free: a handful of relaxed atomic adds, plus a one-time allocation on
+ * a device's first transfer.
+ * @param devAddr I2C slave device address (may carry the adapter)
+ * @param regAddr First register transferred, selects the register range
+ * @param bytesRead Data bytes read from the device
+ * @param bytesWritten Bytes written to the device, register address included
+ * @param startNs CLOCK_MONOTONIC time the transfer started
+ * @param endNs CLOCK_MONOTONIC time the transfer ended
+ */
+void I2Cstats::record(uint16_t devAddr, uint8_t regAddr, uint16_t bytesRead, uint16_t bytesWritten,
+        uint64_t startNs, uint64_t endNs) {
+    if (!active.load(std::memory_order_relaxed)) return;
+
+    Device *d = device(devAddr, true);
+    uint64_t ns = endNs - startNs;
+    Bus &bus = buses[I2CBUS_ADAPTER(devAddr)];
+
+    bus.transfers.fetch_add(1, std::memory_order_relaxed);
+    bus.bytes.fetch_add(bytesRead + bytesWritten, std::memory_order_relaxed);
+    bus.busyNs.fetch_add(ns, std::memory_order_relaxed);
+    if (d == NULL) return;
+
+    Histogram &h = d->ranges[regAddr >> I2CSTATS_RANGE_SHIFT];
+    h.transfers.fetch_add(1, std::memory_order_relaxed);
+    h.bytesRead.fetch_add(bytesRead, std::memory_order_relaxed);
+    h.bytesWritten.fetch_add(bytesWritten, std::memory_order_relaxed);
+    h.busyNs.fetch_add(ns, std::memory_order_relaxed);
+    h.buckets[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t max = h.maxNs.load(std::memory_order_relaxed);
+    while (ns > max && !h.maxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed));
+}
+
+/** Copy the statistics of a device, all register ranges merged.
+ * Counters are read one by one while recording goes on, so the copy is
+ * consistent to within the transfers that complete during the call.
+ * @param devAddr I2C slave device address (may carry the adapter)
+ * @param out Snapshot to fill in
+ * @return False if nothing was ever recorded for the device (out is zeroed)
+ */
+bool I2Cstats::snapshot(uint16_t devAddr, Snapshot &out) {
+    Device *d = device(devAddr, false);
+
+    memset(&out, 0, sizeof(out));
+    if (d == NULL) return false;
+    for (int r = 0; r < I2CSTATS_RANGES; r++) add(out, d->ranges[r]);
+    return true;
+}
+
+/** Copy the statistics of the register range a register falls in.
+ * @param devAddr I2C slave device address (may carry the adapter)
+ * @param regAddr Any register of the range
+ * @param out Snapshot to fill in
+ * @return False if nothing was ever recorded for the device (out is zeroed)
+ */
+bool I2Cstats::snapshot(uint16_t devAddr, uint8_t regAddr, Snapshot &out) {
+    Device *d = device(devAddr, false);
+
+    memset(&out, 0, sizeof(out));
+    if (d == NULL) return false;
+    add(out, d->ranges[regAddr >> I2CSTATS_RANGE_SHIFT]);
+    return true;
+}
+
+/** Copy the totals of an adapter. busyNs / elapsedNs is its utilization.
+ * @param adapter Adapter number (N in /dev/i2c-N)
+ * @param out Snapshot to fill in
+ */
+void I2Cstats::busSnapshot(uint8_t adapter, BusSnapshot &out) {
+    memset(&out, 0, sizeof(out));
+    if (adapter >= I2CBUS_MAX_ADAPTERS) return;
+    out.transfers = buses[adapter].transfers.load(std::memory_order_relaxed);
+    out.bytes = buses[adapter].bytes.load(std::memory_order_relaxed);
+    out.busyNs = buses[adapter].busyNs.load(std::memory_order_relaxed);
+    out.elapsedNs = monotonicNs() - since.load(std::memory_order_relaxed);
+}
+
+/** Estimate a latency percentile from a snapshot.
+ * @param snap Snapshot to look at
+ * @param fraction Percentile as a fraction, e.g. 0.99
+ * @return Upper bound of the bucket holding the percentile in ns (0 if empty)
+ */
+uint64_t I2Cstats::percentile(const Snapshot &snap, double fraction) {
+    uint64_t total = 0, seen = 0;
+
+    for (int b = 0; b < I2CSTATS_BUCKETS; b++) total += snap.buckets[b];
+    if (total == 0) return 0;
+    uint64_t rank = (uint64_t)(fraction * total);
+    if (rank >= total) rank = total - 1;
+    for (int b = 0; b < I2CSTATS_BUCKETS; b++) {
+        seen += snap.buckets[b];
+        if (seen > rank) {
+            uint64_t limit = bucketLimit(b);
+            return limit < snap.maxNs ? limit : snap.maxNs;
+        }
+    }
+    return snap.maxNs;
+}
+
+/** Zero every histogram and counter and restart the utilization clock.
+ * Transfers recorded concurrently may survive the reset.
+ */
+void I2Cstats::reset() {
+    for (int i = 0; i < I2CBUS_MAX_ADAPTERS * 128; i++) {
+        Device *d = devices[i].load(std::memory_order_acquire);
+        if (d == NULL) continue;
+        for (int r = 0; r < I2CSTATS_RANGES; r++) {
+            Histogram &h = d->ranges[r];
+            h.transfers.store(0, std::memory_order_relaxed);
+            h.bytesRead.store(0, std::memory_order_relaxed);
+            h.bytesWritten.store(0, std::memory_order_relaxed);
+            h.busyNs.store(0, std::memory_order_relaxed);
+            h.maxNs.store(0, std::memory_order_relaxed);
+            for (int b = 0; b < I2CSTATS_BUCKETS; b++) h.buckets[b].store(0, std::memory_order_relaxed);
+        }
+    }
+    for (int a = 0; a < I2CBUS_MAX_ADAPTERS; a++) {
+        buses[a].transfers.store(0, std::memory_order_relaxed);
+        buses[a].bytes.store(0, std::memory_order_relaxed);
+        buses[a].busyNs.store(0, std::memory_order_relaxed);
+    }
+    since.store(monotonicNs(), std::memory_order_relaxed);
+}
+
+/** Print a table of every register range that saw traffic, then the
+ * utilization of every adapter that did.
+ * @param out Stream to print to
+ */
+void I2Cstats::dump(FILE *out) {
+    Snapshot snap;
+
+    fprintf(out, "bus   addr regs       transfers     read    written   p50 us   p99 us   max us  busy ms\n");
+    for (int i = 0; i < I2CBUS_MAX_ADAPTERS * 128; i++) {
+        Device *d = devices[i].load(std::memory_order_acquire);
+        if (d == NULL) continue;
+        for (int r = 0; r < I2CSTATS_RANGES; r++) {
+            memset(&snap, 0, sizeof(snap));
+            add(snap, d->ranges[r]);
+            if (snap.transfers == 0) continue;
+            fprintf(out, "i2c-%-2d 0x%02x 0x%02x-0x%02x %9llu %8llu %10llu %8.1f %8.1f %8.1f %8.1f\n",
+                i / 128, i % 128, r << I2CSTATS_RANGE_SHIFT, ((r + 1) << I2CSTATS_RANGE_SHIFT) - 1,
+                (unsigned long long)snap.transfers, (unsigned long long)snap.bytesRead,
+                (unsigned long long)snap.bytesWritten, percentile(snap, 0.5) / 1000.0,
+                percentile(snap, 0.99) / 1000.0, snap.maxNs / 1000.0, snap.busyNs / 1000000.0);
+        }
+    }
+    for (int a = 0; a < I2CBUS_MAX_ADAPTERS; a++) {
+        BusSnapshot bus;
+        busSnapshot(a, bus);
+        if (bus.transfers == 0) continue;
+        fprintf(out, "i2c-%d: %llu transfers, %llu bytes, busy %.1f ms of %.1f ms (%.1f%%)\n", a,
+            (unsigned long long)bus.transfers, (unsigned long long)bus.bytes, bus.busyNs / 1000000.0,
+            bus.elapsedNs / 1000000.0, bus.elapsedNs ? 100.0 * bus.busyNs / bus.elapsedNs : 0.0);
+    }
+}
+
+/** Turn recording on or off (on by default).
+ * @param enabled True to record
+ */
+void I2Cstats::setEnabled(bool enabled) {
+    active.store(enabled, std::memory_order_relaxed);
+}
+
+/** Map a duration to its histogram bucket: exact below 2^SUB_BITS ns, then
+ * SUB_COUNT linear steps per power of two.
+ * @param ns Duration in nanoseconds
+ * @return Bucket index, clamped to the last bucket
+ */
+int I2Cstats::bucketOf(uint64_t ns) {
+    if (ns < SUB_COUNT) return (int)ns;
+    int msb = 63 - __builtin_clzll(ns);
+    int bucket = (msb - I2CSTATS_SUB_BITS + 1) * SUB_COUNT + (int)((ns >> (msb - I2CSTATS_SUB_BITS)) & (SUB_COUNT - 1));
+    return bucket < I2CSTATS_BUCKETS ? bucket : I2CSTATS_BUCKETS - 1;
+}
+
+/** Get the largest duration that maps to a bucket.
+ * @param bucket Bucket index
+ * @return Duration in nanoseconds
+ */
+uint64_t I2Cstats::bucketLimit(int bucket) {
+    if (bucket < SUB_COUNT) return bucket;
+    int msb = bucket / SUB_COUNT + I2CSTATS_SUB_BITS - 1;
+    uint64_t sub = bucket % SUB_COUNT;
+    return ((SUB_COUNT + sub + 1) << (msb - I2CSTATS_SUB_BITS)) - 1;
+}
+
+I2Cstats::Device *I2Cstats::device(uint16_t devAddr, bool create) {
+    std::atomic<Device *> &slot = devices[I2CBUS_ADAPTER(devAddr) * 128 + I2CBUS_SLAVE(devAddr)];
+    Device *d = slot.load(std::memory_order_acquire);
+
+    if (d != NULL || !create) return d;
+    Device *fresh = (Device *)calloc(1, sizeof(Device));
+    if (fresh == NULL) return NULL;
+    if (since.load(std::memory_order_relaxed) == 0) {
+        uint64_t zero = 0;
+        since.compare_exchange_strong(zero, monotonicNs(), std::memory_order_relaxed);
+    }
+    if (!slot.compare_exchange_strong(d, fresh, std::memory_order_acq_rel)) {
+        free(fresh);
+        return d;
+    }
+    return fresh;
+}
+
+void I2Cstats::add(Snapshot &out, const Histogram &h) {
+    out.transfers += h.transfers.load(std::memory_order_relaxed);
+    out.bytesRead += h.bytesRead.load(std::memory_order_relaxed);
+    out.bytesWritten += h.bytesWritten.load(std::memory_order_relaxed);
+    out.busyNs += h.busyNs.load(std::memory_order_relaxed);
+    uint64_t max = h.maxNs.load(std::memory_order_relaxed);
+    if (max > out.maxNs) out.maxNs = max;
+    for (int b = 0; b < I2CSTATS_BUCKETS; b++) {
+        out.buckets[b] += h.buckets[b].load(std::memory_order_relaxed);
+    }
+}
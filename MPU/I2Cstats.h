@@ -0,0 +1,111 @@
+// I2Cdev library collection - I2C transfer latency and bus utilization
+// Records the duration of every transfer in lock-free log-linear histograms,
+// per device and per range of 16 registers, together with bytes moved and the
+// time each adapter spent busy, so the calls that dominate a bus can be found
+// at runtime.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CSTATS_H_
+#define _I2CSTATS_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <atomic>
+#include "I2Cbus.h"
+
+#define I2CSTATS_RANGE_SHIFT    4   // registers per range = 1 << shift
+#define I2CSTATS_RANGES         (256 >> I2CSTATS_RANGE_SHIFT)
+#define I2CSTATS_SUB_BITS       3   // 8 linear sub-buckets per power of two (<= 12.5% error)
+#define I2CSTATS_BUCKETS        240 // covers 0 ns .. ~4.3 s, longer is clamped
+
+class I2Cstats {
+    public:
+        // Plain copy of one histogram and its totals, see snapshot().
+        struct Snapshot {
+            uint64_t transfers;
+            uint64_t bytesRead;
+            uint64_t bytesWritten;
+            uint64_t busyNs;
+            uint64_t maxNs;
+            uint32_t buckets[I2CSTATS_BUCKETS];
+        };
+
+        struct BusSnapshot {
+            uint64_t transfers;
+            uint64_t bytes;
+            uint64_t busyNs;
+            uint64_t elapsedNs;     // since start-up or the last reset()
+        };
+
+        static void record(uint16_t devAddr, uint8_t regAddr, uint16_t bytesRead, uint16_t bytesWritten,
+            uint64_t startNs, uint64_t endNs);
+
+        static bool snapshot(uint16_t devAddr, Snapshot &out);
+        static bool snapshot(uint16_t devAddr, uint8_t regAddr, Snapshot &out);
+        static void busSnapshot(uint8_t adapter, BusSnapshot &out);
+        static uint64_t percentile(const Snapshot &snap, double fraction);
+        static void reset();
+        static void dump(FILE *out);
+
+        static void setEnabled(bool enabled);
+        static bool enabled() { return active.load(std::memory_order_relaxed); }
+
+        static int bucketOf(uint64_t ns);
+        static uint64_t bucketLimit(int bucket);
+
+    private:
+        struct Histogram {
+            std::atomic<uint64_t> transfers;
+            std::atomic<uint64_t> bytesRead;
+            std::atomic<uint64_t> bytesWritten;
+            std::atomic<uint64_t> busyNs;
+            std::atomic<uint64_t> maxNs;
+            std::atomic<uint32_t> buckets[I2CSTATS_BUCKETS];
+        };
+
+        struct Device {
+            Histogram ranges[I2CSTATS_RANGES];
+        };
+
+        struct Bus {
+            std::atomic<uint64_t> transfers;
+            std::atomic<uint64_t> bytes;
+            std::atomic<uint64_t> busyNs;
+        };
+
+        static Device *device(uint16_t devAddr, bool create);
+        static void add(Snapshot &out, const Histogram &h);
+
+        static std::atomic<Device *> devices[I2CBUS_MAX_ADAPTERS * 128];
+        static Bus buses[I2CBUS_MAX_ADAPTERS];
+        static std::atomic<uint64_t> since;
+        static std::atomic<bool> active;
+};
+
+#endif /* _I2CSTATS_H_ */
@@ -0,0 +1,364 @@
+// I2Cdev library collection - I2C traffic capture and replay
+// I2Ctrace sits between I2Cbus and a real transport and appends every message
+// (time, address, register, direction, payload, result) to a compact binary
+// trace file. I2Creplay is a transport that answers from such a trace, so a
+// workload captured in the field can be rerun and timed on a workstation.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <linux/i2c.h>
+#include "I2Cbus.h"
+#include "I2Ctrace.h"
+
+static_assert(sizeof(I2CtraceHeader) == 8, "trace header layout");
+static_assert(sizeof(I2CtraceRecord) == 16, "trace record layout");
+
+/** Record the traffic of another transport.
+ * The trace file is created (truncated) when the bus is first opened, so a
+ * failure to create it is reported by I2Cbus::get(). Neither inner nor path
+ * is copied; both must outlive the trace.
+ * @param inner Transport that does the actual transfers, e.g. an I2Clinux
+ * @param path Trace file to write
+ */
+I2Ctrace::I2Ctrace(I2Ctransport *inner, const char *path) : inner(inner), path(path),
+        file(NULL), adapter(0), slave(0), last(0), written(0), lost(0) {
+    memset(pointer, 0, sizeof(pointer));
+}
+
+I2Ctrace::~I2Ctrace() {
+    if (file != NULL) fclose(file);
+}
+
+int I2Ctrace::open(uint8_t adapter) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (file == NULL) {
+        I2CtraceHeader header = { I2CTRACE_MAGIC, I2CTRACE_VERSION, adapter, 0 };
+
+        file = fopen(path, "wbe");
+        if (file == NULL) return -1;
+        if (fwrite(&header, sizeof(header), 1, file) != 1) {
+            fclose(file);
+            file = NULL;
+            return -1;
+        }
+        last = monotonicNs();
+    }
+    this->adapter = adapter;
+    return inner->open(adapter);
+}
+
+/** Close the inner transport and push buffered records to the file.
+ */
+void I2Ctrace::close() {
+    std::lock_guard<std::mutex> guard(lock);
+    inner->close();
+    if (file != NULL) fflush(file);
+}
+
+int I2Ctrace::setSlave(uint8_t devAddr) {
+    int result = inner->setSlave(devAddr);
+    if (result >= 0) slave = devAddr & 0x7F;
+    return result;
+}
+
+int I2Ctrace::write(const uint8_t *buf, uint16_t length) {
+    uint64_t start = monotonicNs();
+    int result = inner->write(buf, length);
+    int saved = errno;
+
+    record(slave, 0, buf, length, result, saved, start, monotonicNs());
+    errno = saved;
+    return result;
+}
+
+int I2Ctrace::read(uint8_t *buf, uint16_t length) {
+    uint64_t start = monotonicNs();
+    int result = inner->read(buf, length);
+    int saved = errno;
+
+    record(slave, I2CTRACE_READ, buf, length, result, saved, start, monotonicNs());
+    errno = saved;
+    return result;
+}
+
+int I2Ctrace::transfer(struct i2c_msg *msgs, int count) {
+    uint64_t start = monotonicNs();
+    int result = inner->transfer(msgs, count);
+    uint64_t end = monotonicNs();
+    int saved = errno;
+
+    for (int i = 0; i < count; i++) {
+        uint8_t flags = I2CTRACE_COMBINED | ((msgs[i].flags & I2C_M_RD) ? I2CTRACE_READ : 0);
+        // the kernel does not say which message failed, so all of them did
+        record(msgs[i].addr, flags, msgs[i].buf, msgs[i].len, result < 0 ? -1 : msgs[i].len,
+            saved, start, i == 0 ? end : start);
+    }
+    errno = saved;
+    return result;
+}
+
+// Gathered writes (I2C_M_NOSTART) are hidden, so every message is traced
+// with its register byte and replays the same way on any transport.
+int I2Ctrace::getFunctionality(unsigned long *funcs) {
+    int result = inner->getFunctionality(funcs);
+    if (result >= 0) *funcs &= ~I2C_FUNC_NOSTART;
+    return result;
+}
+
+// Appends one record; error is the errno of a failed result.
+void I2Ctrace::record(uint8_t slave, uint8_t flags, const uint8_t *buf, uint16_t length,
+        int result, int error, uint64_t start, uint64_t end) {
+    std::lock_guard<std::mutex> guard(lock);
+    I2CtraceRecord entry;
+    uint16_t payload;
+
+    if (file == NULL) return;
+    slave &= 0x7F;
+    if (!(flags & I2CTRACE_READ) && length > 0) {
+        pointer[slave] = buf[0];
+    }
+    entry.delta = (start - last) / 1000 > UINT32_MAX ? UINT32_MAX : (uint32_t)((start - last) / 1000);
+    entry.duration = end - start > UINT32_MAX ? UINT32_MAX : (uint32_t)(end - start);
+    entry.devAddr = I2CBUS_ADDRESS(adapter, slave);
+    entry.regAddr = pointer[slave];
+    entry.flags = flags | (result < 0 ? I2CTRACE_FAILED : 0);
+    entry.result = result < 0 ? -error : result;
+    entry.length = length;
+    last = start;
+
+    if (flags & I2CTRACE_READ) {
+        payload = result > 0 ? result : 0;
+    } else {
+        payload = length;
+    }
+    if (fwrite(&entry, sizeof(entry), 1, file) != 1 ||
+            (payload > 0 && fwrite(buf, payload, 1, file) != 1)) {
+        lost++;
+        return;
+    }
+    written++;
+}
+
+/** Serve transfers from a trace written by I2Ctrace.
+ * The file is loaded when the bus is first opened. Each message is matched
+ * to the next recorded message with the same slave and direction (and, for
+ * reads, the same starting register); reads return the recorded data and
+ * recorded failures fail again with the recorded errno. A message with no
+ * match fails with ENODATA.
+ * @param path Trace file to read (not copied)
+ */
+I2Creplay::I2Creplay(const char *path) : path(path), cursor(0), opened(false),
+        realTime(true), loop(false), slave(0), hits(0), misses(0), divergences(0) {
+    memset(pointer, 0, sizeof(pointer));
+}
+
+/** Choose whether replayed messages take their recorded duration in
+ * wall-clock time (the default, by spinning) or return at once.
+ * @param enabled True to spin
+ */
+void I2Creplay::setRealTime(bool enabled) {
+    realTime = enabled;
+}
+
+/** Choose whether matching wraps around to the start of the trace once the
+ * end is reached, for running a short capture over and over.
+ * @param enabled True to wrap
+ */
+void I2Creplay::setLoop(bool enabled) {
+    loop = enabled;
+}
+
+/** Start matching from the first record again and clear the counters.
+ */
+void I2Creplay::rewind() {
+    std::lock_guard<std::mutex> guard(lock);
+    cursor = 0;
+    hits = misses = divergences = 0;
+}
+
+int I2Creplay::open(uint8_t adapter) {
+    std::lock_guard<std::mutex> guard(lock);
+    (void)adapter;
+    if (offsets.empty() && load() < 0) return -1;
+    opened = true;
+    return 0;
+}
+
+void I2Creplay::close() {
+    opened = false;
+}
+
+int I2Creplay::setSlave(uint8_t devAddr) {
+    if (devAddr > 0x7F) {
+        errno = EINVAL;
+        return -1;
+    }
+    slave = devAddr;
+    return 0;
+}
+
+int I2Creplay::write(const uint8_t *buf, uint16_t length) {
+    std::lock_guard<std::mutex> guard(lock);
+    return replay(slave, 0, (uint8_t *)buf, length, true);
+}
+
+int I2Creplay::read(uint8_t *buf, uint16_t length) {
+    std::lock_guard<std::mutex> guard(lock);
+    return replay(slave, I2CTRACE_READ, buf, length, true);
+}
+
+int I2Creplay::transfer(struct i2c_msg *msgs, int count) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    for (int i = 0; i < count; i++) {
+        uint8_t flags = (msgs[i].flags & I2C_M_RD) ? I2CTRACE_READ : 0;
+        if (replay(msgs[i].addr, flags, msgs[i].buf, msgs[i].len, i == 0) < 0) return -1;
+    }
+    return count;
+}
+
+int I2Creplay::setTimeout(int32_t ticks) {
+    (void)ticks;
+    return 0;
+}
+
+int I2Creplay::setRetries(int32_t count) {
+    (void)count;
+    return 0;
+}
+
+int I2Creplay::getFunctionality(unsigned long *funcs) {
+    *funcs = I2C_FUNC_I2C;
+    return 0;
+}
+
+// Reads the whole trace and indexes its records.
+int I2Creplay::load() {
+    FILE *file = fopen(path, "rbe");
+    I2CtraceHeader header;
+    uint8_t chunk[4096];
+    size_t n, offset;
+
+    if (file == NULL) return -1;
+    trace.clear();
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        trace.insert(trace.end(), chunk, chunk + n);
+    }
+    fclose(file);
+
+    if (trace.size() < sizeof(header)) {
+        errno = EINVAL;
+        return -1;
+    }
+    memcpy(&header, trace.data(), sizeof(header));
+    if (header.magic != I2CTRACE_MAGIC || header.version != I2CTRACE_VERSION) {
+        errno = EINVAL;
+        return -1;
+    }
+    offsets.clear();
+    offset = sizeof(header);
+    while (offset + sizeof(I2CtraceRecord) <= trace.size()) {
+        I2CtraceRecord entry;
+        size_t payload;
+
+        memcpy(&entry, &trace[offset], sizeof(entry));
+        if (entry.flags & I2CTRACE_READ) {
+            payload = entry.result > 0 ? entry.result : 0;
+        } else {
+            payload = entry.length;
+        }
+        if (offset + sizeof(entry) + payload > trace.size()) break;  // cut short
+        offsets.push_back(offset);
+        offset += sizeof(entry) + payload;
+    }
+    cursor = 0;
+    return 0;
+}
+
+// Index of the next record for this message, or -1.
+int I2Creplay::find(uint8_t slave, uint8_t flags, uint8_t regAddr) {
+    size_t end = offsets.size();
+
+    for (int pass = 0; pass < (loop ? 2 : 1); pass++) {
+        for (size_t i = pass == 0 ? cursor : 0; i < end; i++) {
+            I2CtraceRecord entry;
+
+            memcpy(&entry, &trace[offsets[i]], sizeof(entry));
+            if (I2CBUS_SLAVE(entry.devAddr) != slave) continue;
+            if ((entry.flags & I2CTRACE_READ) != (flags & I2CTRACE_READ)) continue;
+            if ((flags & I2CTRACE_READ) && entry.regAddr != regAddr) continue;
+            return i;
+        }
+        end = cursor;
+    }
+    return -1;
+}
+
+int I2Creplay::replay(uint8_t slave, uint8_t flags, uint8_t *buf, uint16_t length, bool pace) {
+    I2CtraceRecord entry;
+    const uint8_t *payload;
+    int index;
+
+    slave &= 0x7F;
+    if (!(flags & I2CTRACE_READ) && length > 0) {
+        pointer[slave] = buf[0];
+    }
+    index = find(slave, flags, pointer[slave]);
+    if (index < 0) {
+        misses++;
+        errno = ENODATA;
+        return -1;
+    }
+    cursor = index + 1;
+    hits++;
+    memcpy(&entry, &trace[offsets[index]], sizeof(entry));
+    payload = &trace[offsets[index] + sizeof(entry)];
+
+    if (realTime && pace && entry.duration > 0) {
+        uint64_t until = monotonicNs() + entry.duration;
+        while (monotonicNs() < until);
+    }
+    if (entry.flags & I2CTRACE_FAILED) {
+        errno = -entry.result;
+        return -1;
+    }
+    if (entry.length != length) divergences++;
+    if (flags & I2CTRACE_READ) {
+        uint16_t available = entry.result < length ? entry.result : length;
+        memcpy(buf, payload, available);
+        memset(buf + available, 0, length - available);
+    } else if (entry.length == length && memcmp(buf, payload, length) != 0) {
+        divergences++;
+    }
+    return entry.length == length ? entry.result : length;
+}
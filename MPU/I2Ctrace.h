@@ -0,0 +1,160 @@
+// I2Cdev library collection - I2C traffic capture and replay
+// I2Ctrace sits between I2Cbus and a real transport and appends every message
+// (time, address, register, direction, payload, result) to a compact binary
+// trace file. I2Creplay is a transport that answers from such a trace, so a
+// workload captured in the field can be rerun and timed on a workstation.
+//
+// Example:
+//     I2Clinux linux;
+//     I2Ctrace trace(&linux, "capture.i2ct");
+//     I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &trace);
+//     // ... run the workload; later, anywhere:
+//     I2Creplay replay("capture.i2ct");
+//     I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &replay);
+//
+// File format (host byte order): an I2CtraceHeader, then one I2CtraceRecord
+// per message, each followed by its payload - the bytes written, or the bytes
+// read when the read succeeded. Messages of one I2C_RDWR transfer carry
+// I2CTRACE_COMBINED, and the transfer's duration is charged to the first one.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CTRACE_H_
+#define _I2CTRACE_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <mutex>
+#include <vector>
+#include "I2Ctransport.h"
+
+#define I2CTRACE_MAGIC      0x54433249  // "I2CT"
+#define I2CTRACE_VERSION    1
+
+#define I2CTRACE_READ       0x01
+#define I2CTRACE_FAILED     0x02
+#define I2CTRACE_COMBINED   0x04
+
+struct I2CtraceHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t adapter;        // adapter the trace was captured on
+    uint8_t reserved;
+};
+
+struct I2CtraceRecord {
+    uint32_t delta;         // us since the previous record started
+    uint32_t duration;      // ns spent in the transport
+    uint16_t devAddr;       // I2CBUS_ADDRESS(adapter, slave)
+    uint8_t regAddr;        // first byte written, or the register a read starts at
+    uint8_t flags;          // I2CTRACE_*
+    int16_t result;         // bytes transferred, or -errno
+    uint16_t length;        // bytes requested
+};
+
+class I2Ctrace : public I2Ctransport {
+    public:
+        I2Ctrace(I2Ctransport *inner, const char *path);
+        ~I2Ctrace();
+
+        int open(uint8_t adapter);
+        void close();
+        bool isOpen() const { return inner->isOpen(); }
+
+        int setSlave(uint8_t devAddr);
+        int write(const uint8_t *buf, uint16_t length);
+        int read(uint8_t *buf, uint16_t length);
+        int transfer(struct i2c_msg *msgs, int count);
+        int setTimeout(int32_t ticks) { return inner->setTimeout(ticks); }
+        int setRetries(int32_t count) { return inner->setRetries(count); }
+        int getFunctionality(unsigned long *funcs);
+
+        int handle() const { return inner->handle(); }
+        uint32_t records() const { return written; }
+        uint32_t dropped() const { return lost; }
+
+    private:
+        void record(uint8_t slave, uint8_t flags, const uint8_t *buf, uint16_t length,
+            int result, int error, uint64_t start, uint64_t end);
+
+        I2Ctransport *inner;
+        const char *path;
+        FILE *file;
+        uint8_t adapter;
+        uint8_t slave;
+        uint8_t pointer[128];   // last register written to each slave
+        uint64_t last;          // start of the previous record
+        uint32_t written;
+        uint32_t lost;          // records that could not be written
+        std::mutex lock;
+};
+
+class I2Creplay : public I2Ctransport {
+    public:
+        I2Creplay(const char *path);
+
+        void setRealTime(bool enabled);
+        void setLoop(bool enabled);
+        void rewind();
+        uint32_t matched() const { return hits; }
+        uint32_t missed() const { return misses; }
+        uint32_t diverged() const { return divergences; }
+
+        int open(uint8_t adapter);
+        void close();
+        bool isOpen() const { return opened; }
+
+        int setSlave(uint8_t devAddr);
+        int write(const uint8_t *buf, uint16_t length);
+        int read(uint8_t *buf, uint16_t length);
+        int transfer(struct i2c_msg *msgs, int count);
+        int setTimeout(int32_t ticks);
+        int setRetries(int32_t count);
+        int getFunctionality(unsigned long *funcs);
+
+    private:
+        int load();
+        int replay(uint8_t slave, uint8_t flags, uint8_t *buf, uint16_t length, bool pace);
+        int find(uint8_t slave, uint8_t flags, uint8_t regAddr);
+
+        const char *path;
+        std::vector<uint8_t> trace;
+        std::vector<uint32_t> offsets;  // of each record in trace
+        size_t cursor;                  // next record to consider
+        bool opened;
+        bool realTime;      // spin for the recorded duration
+        bool loop;          // start over at the end of the trace
+        uint8_t slave;
+        uint8_t pointer[128];
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t divergences;
+        std::mutex lock;
+};
+
+#endif /* _I2CTRACE_H_ */
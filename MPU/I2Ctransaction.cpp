@@ -0,0 +1,349 @@
+// I2Cdev library collection - batched I2C transaction builder
+// Queues register reads and writes, possibly to several slave devices, and
+// submits them as combined I2C_RDWR transactions instead of one syscall each.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <algorithm>
+#include <linux/i2c.h>
+#include "I2Ctransaction.h"
+#include "I2Cdev.h"
+#include "I2Ccache.h"
+#include "I2Ccoalesce.h"
+#include "I2Cerrors.h"
+#include "I2Cretry.h"
+#include "I2Cstats.h"
+#include "I2Ctransport.h"
+
+/** Create an empty transaction.
+ * Operations may address devices on any adapter by passing an address built
+ * with I2CBUS_ADDRESS(); plain 7-bit addresses go to the adapter given here.
+ * @param adapter Adapter number (N in /dev/i2c-N) for plain addresses
+ */
+I2Ctransaction::I2Ctransaction(uint8_t adapter) : adapter(adapter), grouping(false), groupStart(0) {
+}
+
+/** Queue a single byte read from an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param data Container for byte value, filled in by submit()
+ */
+void I2Ctransaction::readByte(uint16_t devAddr, uint8_t regAddr, uint8_t *data) {
+    readBytes(devAddr, regAddr, 1, data);
+}
+
+/** Queue a read of multiple bytes from an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in, filled in by submit()
+ */
+void I2Ctransaction::readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    Op op;
+
+    op.devAddr = fullAddress(devAddr);
+    op.read = true;
+    op.offset = payload.size();
+    op.length = length;
+    op.data = data;
+    op.replay = grouping ? groupStart : ops.size();
+    op.once = false;
+    payload.push_back(regAddr);
+    ops.push_back(op);
+}
+
+/** Queue a single byte write to an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register address to write to
+ * @param data New byte value to write
+ */
+void I2Ctransaction::writeByte(uint16_t devAddr, uint8_t regAddr, uint8_t data) {
+    writeBytes(devAddr, regAddr, 1, &data);
+}
+
+/** Queue a write of multiple bytes to an 8-bit device register.
+ * The data is copied, so the caller's buffer may be reused immediately.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ */
+void I2Ctransaction::writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data) {
+    Op op;
+
+    op.devAddr = fullAddress(devAddr);
+    op.read = false;
+    op.offset = payload.size();
+    op.length = length;
+    op.data = NULL;
+    op.replay = grouping ? groupStart : ops.size();
+    op.once = false;
+    payload.push_back(regAddr);
+    payload.insert(payload.end(), data, data + length);
+    ops.push_back(op);
+}
+
+/** Mark the operation queued last as one that must not be repeated: a read
+ * of a clear-on-read register such as INT_STATUS, or of a data port such as
+ * FIFO_R_W. Its register write carries I2CTRANSPORT_M_ONCE, and a transaction
+ * holding such an operation is never retried.
+ */
+void I2Ctransaction::once() {
+    if (!ops.empty()) ops.back().once = true;
+}
+
+/** Start a group of operations that only make sense together, such as
+ * BANK_SEL and MEM_START_ADDR writes followed by a MEM_R_W access. When an
+ * operation of the group fails, a retry starts again from the group's first
+ * operation instead of from the failed ioctl. The group runs up to the next
+ * group() call or the end of the transaction.
+ */
+void I2Ctransaction::group() {
+    grouping = true;
+    groupStart = ops.size();
+}
+
+/** Run every queued operation in order and empty the queue.
+ * Operations are packed into as few I2C_RDWR ioctls as the kernel's message
+ * limit allows; a register read (address write + data read) is never split
+ * across two ioctls, and operations on different adapters go to separate
+ * ioctls in queue order. Read results are scattered into the caller buffers
+ * given when the reads were queued. Submission stops at the first failed ioctl,
+ * since later operations may depend on earlier ones. Writes still buffered in
+ * I2Ccache write-back mode for any of the devices are flushed first. In the
+ * bulk priority class an ioctl carries about I2CBUS_BULK_CHUNK bytes, so
+ * urgent transfers get the bus between them.
+ * Devices with an I2Cretry policy are admitted before their first operation
+ * goes out; the transaction stops at a sidelined device. A failed ioctl is
+ * retried as its first device's policy says, from its first operation (or the
+ * start of its group(), see there), since it may have been carried out in
+ * part; ioctls that completed are not sent again. A transaction holding a
+ * once() operation is never retried. Every admitted device is then told
+ * whether its operations went through.
+ * Like an I2Cdev call, every ioctl is bounded by the thread's deadline (see
+ * I2Cdev::setDeadline()); once it has passed, submission stops and errno is
+ * ETIMEDOUT, as it is for a write that timed out.
+ * @return Status of operation (true = every operation completed, false =
+ *         failure, or timeout when errno is ETIMEDOUT)
+ */
+bool I2Ctransaction::submit() {
+    std::vector<uint16_t> devices;  // admitted by I2Cretry, in queue order
+    size_t first = 0, last = 0;     // operations of the failed ioctl
+    size_t start = 0;               // where the next attempt starts
+    bool repeatable = true;
+    int8_t status;
+    int err;
+
+    // registers buffered by I2Ccache write-back go out before anything queued
+    for (size_t i = 0; i < ops.size(); i++) {
+        if (!I2Ccache::flush(ops[i].devAddr)) {
+            clear();
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < ops.size(); i++) repeatable = repeatable && !ops[i].once;
+    for (uint8_t attempt = 0; (status = run(start, devices, first, last)) == 0 && repeatable && first < last &&
+        I2Cretry::again(ops[first].devAddr, attempt, errno, I2Cdev::getDeadline()); attempt++) {
+        start = ops[first].replay;
+    }
+    // every admitted device has an operation in an ioctl that went out
+    // (or was meant to and failed), so each gets a verdict of its own
+    err = errno;
+    for (size_t d = 0; d < devices.size(); d++) {
+        bool culprit = false;
+        for (size_t i = first; status <= 0 && i < last && !culprit; i++) culprit = ops[i].devAddr == devices[d];
+        if (culprit) {
+            I2Cretry::failed(devices[d]);
+        } else {
+            I2Cretry::succeeded(devices[d]);
+        }
+    }
+    clear();
+    errno = err;
+
+    return status > 0;
+}
+
+// The ioctl being packed: its messages, and the operations they carry from
+// first up to the operation being looked at.
+struct I2Ctransaction::Chunk {
+    struct i2c_msg msgs[I2CTRANSACTION_MAX_MSGS];
+    int count;
+    uint16_t read;
+    uint16_t written;
+    size_t first;
+};
+
+/** One pass over the queued operations for submit(), from start on.
+ * The ioctl packed so far goes out before the device of the next operation
+ * is admitted, so an admitted device always has an operation in the ioctl
+ * that goes out next.
+ * @param start First operation to run; those before it have completed
+ * @param devices Devices admitted by I2Cretry so far; extended as new ones
+ *        come up, and not admitted twice
+ * @param first Set to the first operation of the ioctl that failed
+ * @param last Set past the last operation of the ioctl that failed; equal
+ *        to first if no ioctl failed, e.g. when a device is sidelined
+ * @return Status of operation (1 = every operation completed, 0 = failure,
+ *         -1 = the thread's deadline ran out, see I2Cdev::setDeadline())
+ */
+int8_t I2Ctransaction::run(size_t start, std::vector<uint16_t> &devices, size_t &first, size_t &last) {
+    Chunk chunk;
+    I2Cbus *bus = NULL;
+    int8_t status;
+    bool bulk = I2Cbus::getPriority() == I2CBUS_PRIORITY_BULK;
+
+    chunk.count = 0;
+    chunk.read = 0;
+    chunk.written = 0;
+    chunk.first = start;
+    for (size_t i = start; i < ops.size(); i++) {
+        const Op &op = ops[i];
+        int needed = op.read ? 2 : 1;
+
+        if (chunk.count > 0 && (I2CBUS_ADAPTER(op.devAddr) != bus->number() ||
+                chunk.count + needed > I2CTRANSACTION_MAX_MSGS ||
+                (bulk && chunk.read + chunk.written + op.length + 1 > I2CBUS_BULK_CHUNK))) {
+            if ((status = send(bus, chunk, i, last)) <= 0) {
+                first = chunk.first;
+                return status;
+            }
+        }
+        if (chunk.count == 0) {
+            bus = I2Cbus::forDevice(op.devAddr);
+            if (bus == NULL) {
+                I2Cerrors::record(op.devAddr, "open", errno);
+                first = i;
+                last = i + 1;
+                return 0;
+            }
+        }
+        if (std::find(devices.begin(), devices.end(), op.devAddr) == devices.end()) {
+            if (!I2Cretry::admit(op.devAddr)) {
+                int err = errno;
+                I2Cerrors::record(op.devAddr, "transaction", err);
+                // what was queued before the sidelined device still goes out
+                if (chunk.count > 0 && (status = send(bus, chunk, i, last)) <= 0) {
+                    first = chunk.first;
+                    return status;
+                }
+                first = last = i;
+                errno = err;
+                return 0;
+            }
+            devices.push_back(op.devAddr);
+        }
+
+        struct i2c_msg *msg = &chunk.msgs[chunk.count];
+        msg->addr = I2CBUS_SLAVE(op.devAddr);
+        msg->flags = op.once ? I2CTRANSPORT_M_ONCE : 0;
+        msg->len = op.read ? 1 : op.length + 1;
+        msg->buf = &payload[op.offset];
+        chunk.written += msg->len;
+        chunk.count++;
+        if (op.read) {
+            msg++;
+            msg->addr = I2CBUS_SLAVE(op.devAddr);
+            msg->flags = I2C_M_RD;
+            msg->len = op.length;
+            msg->buf = op.data;
+            chunk.read += op.length;
+            chunk.count++;
+        }
+    }
+    if (chunk.count > 0 && (status = send(bus, chunk, ops.size(), last)) <= 0) {
+        first = chunk.first;
+        return status;
+    }
+    first = last = ops.size();
+
+    return 1;
+}
+
+/** Send the packed ioctl and start packing the next one.
+ * @param bus Bus of every operation in the chunk
+ * @param chunk The ioctl; emptied, and moved on to end, if it succeeds
+ * @param end Operation after the last one in the chunk
+ * @param last Set to end if the ioctl fails
+ * @return Status of operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Ctransaction::send(I2Cbus *bus, Chunk &chunk, size_t end, size_t &last) {
+    const Op &head = ops[chunk.first];
+    uint64_t started;
+    int32_t budget;
+    int transferred;
+
+    bus->lock();
+    // the thread's deadline bounds every ioctl, and resets what the last
+    // caller left in I2C_TIMEOUT/I2C_RETRIES
+    if ((budget = I2Cdev::startTimeout(bus, 0)) < 0) {
+        bus->unlock();
+        I2Cerrors::record(head.devAddr, "transaction", errno);
+        last = end;
+        return -1;
+    }
+    started = monotonicNs();
+    transferred = bus->transfer(chunk.msgs, chunk.count);
+    bus->unlock();
+    // charged to the chunk's first register, like the errors below
+    I2Cstats::record(head.devAddr, payload[head.offset], transferred == chunk.count ? chunk.read : 0,
+        chunk.written, started, monotonicNs());
+    if (transferred != chunk.count) {
+        bool late = I2Cdev::timedOut(started, budget);
+        // the kernel doesn't say which message failed
+        I2Cerrors::record(head.devAddr, "transaction", errno);
+        last = end;
+        return late ? -1 : 0;
+    }
+    for (; chunk.first < end; chunk.first++) {
+        const Op &done = ops[chunk.first];
+        I2Ccache::update(done.devAddr, payload[done.offset], done.length,
+            done.read ? done.data : &payload[done.offset + 1]);
+        if (!done.read) I2Ccoalesce::invalidate(done.devAddr, payload[done.offset], done.length);
+    }
+    chunk.count = 0;
+    chunk.read = 0;
+    chunk.written = 0;
+
+    return 1;
+}
+
+/** Drop every queued operation without running it.
+ */
+void I2Ctransaction::clear() {
+    ops.clear();
+    payload.clear();
+    grouping = false;
+    groupStart = 0;
+}
@@ -0,0 +1,87 @@
+// I2Cdev library collection - batched I2C transaction builder
+// Queues register reads and writes, possibly to several slave devices, and
+// submits them as combined I2C_RDWR transactions instead of one syscall each.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CTRANSACTION_H_
+#define _I2CTRANSACTION_H_
+
+#include <stdint.h>
+#include <vector>
+#include "I2Cbus.h"
+
+// Kernel limit on messages per I2C_RDWR ioctl (I2C_RDWR_IOCTL_MAX_MSGS)
+#define I2CTRANSACTION_MAX_MSGS 42
+
+class I2Ctransaction {
+    public:
+        I2Ctransaction(uint8_t adapter=I2CBUS_DEFAULT_ADAPTER);
+
+        void readByte(uint16_t devAddr, uint8_t regAddr, uint8_t *data);
+        void readBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        void writeByte(uint16_t devAddr, uint8_t regAddr, uint8_t data);
+        void writeBytes(uint16_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data);
+        void once();
+        void group();
+
+        bool submit();
+        void clear();
+        int size() const { return ops.size(); }
+
+    private:
+        // One queued operation. Write payloads (and the register byte of a
+        // read) are copied into 'payload' so callers may reuse their buffers
+        // before submit(); read data goes straight to the caller's buffer.
+        struct Op {
+            uint16_t devAddr;   // always carries the adapter, see I2CBUS_ADDRESS()
+            bool read;
+            uint32_t offset;    // start of register byte (+ write data) in payload
+            uint8_t length;     // data bytes, excluding the register byte
+            uint8_t *data;      // read destination
+            uint32_t replay;    // operation a retry of this one starts from, see group()
+            bool once;          // must not be repeated, see once()
+        };
+
+        struct Chunk;   // the ioctl being packed, see I2Ctransaction.cpp
+
+        int8_t run(size_t start, std::vector<uint16_t> &devices, size_t &first, size_t &last);
+        int8_t send(I2Cbus *bus, Chunk &chunk, size_t end, size_t &last);
+
+        uint16_t fullAddress(uint16_t devAddr) const {
+            return (devAddr >> 8) ? devAddr : I2CBUS_ADDRESS(adapter, devAddr);
+        }
+
+        uint8_t adapter;
+        std::vector<Op> ops;
+        std::vector<uint8_t> payload;
+        bool grouping;          // group() was called since the last clear()
+        uint32_t groupStart;    // first operation of the current group
+};
+
+#endif /* _I2CTRANSACTION_H_ */
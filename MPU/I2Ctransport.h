@@ -0,0 +1,68 @@
+// I2Cdev library collection - I2C transport interface
+// The operations I2Cbus needs from whatever moves bytes on an adapter: the
+// Linux i2c-dev driver (I2Clinux) on the Pi, or a simulated bus (I2Csim) with
+// register-level device models anywhere else.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CTRANSPORT_H_
+#define _I2CTRANSPORT_H_
+
+#include <stdint.h>
+
+struct i2c_msg;
+
+// i2c_msg flag of this library, in a bit linux/i2c.h leaves unused: the
+// message must not reach the device twice, e.g. a write to a data port that
+// does not advance the register pointer (MEM_R_W, FIFO_R_W). I2Cremote
+// passes it to the bus manager, which never repeats such a request;
+// I2Clinux clears it before the ioctl.
+#define I2CTRANSPORT_M_ONCE     0x0100
+
+// Every call mirrors the i2c-dev system call it replaces: the result is the
+// same as the syscall's, and failures return -1 with errno set.
+class I2Ctransport {
+    public:
+        virtual ~I2Ctransport() {}
+
+        virtual int open(uint8_t adapter) = 0;
+        virtual void close() = 0;
+        virtual bool isOpen() const = 0;
+
+        virtual int setSlave(uint8_t devAddr) = 0;                  // ioctl(I2C_SLAVE)
+        virtual int write(const uint8_t *buf, uint16_t length) = 0; // write() to the slave
+        virtual int read(uint8_t *buf, uint16_t length) = 0;        // read() from the slave
+        virtual int transfer(struct i2c_msg *msgs, int count) = 0;  // ioctl(I2C_RDWR)
+        virtual int setTimeout(int32_t ticks) = 0;                  // ioctl(I2C_TIMEOUT), 10 ms ticks
+        virtual int setRetries(int32_t count) = 0;                  // ioctl(I2C_RETRIES)
+        virtual int getFunctionality(unsigned long *funcs) = 0;     // ioctl(I2C_FUNCS)
+
+        virtual int handle() const { return -1; }   // descriptor to poll, if any
+};
+
+#endif /* _I2CTRANSPORT_H_ */
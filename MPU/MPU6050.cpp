@@ -39,23 +39,50 @@ THE SOFTWARE.
 #include <unistd.h>
 #include <string.h>
 #include <stdint.h>
+#include <time.h>
+#include <sys/uio.h>
 #include "MPU6050.h"
+#include "I2Ctransaction.h"
+#include "I2Ccache.h"
+#include "I2Ccoalesce.h"
+#include "I2Cfield.h"
 
 /** Default constructor, uses default I2C address.
  * @see MPU6050_DEFAULT_ADDRESS
  */
 MPU6050::MPU6050() {
     devAddr = MPU6050_DEFAULT_ADDRESS;
+    streamRecord = 0;
+    streamLost = 0;
+    streamResyncs = 0;
 }
 
 /** Specific address constructor.
- * @param address I2C address
+ * @param address I2C address, optionally carrying the adapter (see I2CBUS_ADDRESS())
  * @see MPU6050_DEFAULT_ADDRESS
  * @see MPU6050_ADDRESS_AD0_LOW
  * @see MPU6050_ADDRESS_AD0_HIGH
  */
-MPU6050::MPU6050(uint8_t address) {
+MPU6050::MPU6050(uint16_t address) {
     devAddr = address;
+    streamRecord = 0;
+    streamLost = 0;
+    streamResyncs = 0;
+}
+
+/** Specific address and bus constructor.
+ * Each adapter is driven through its own descriptor and lock, so sensors
+ * spread over several buses can be read concurrently from separate threads.
+ * @param address I2C address
+ * @param adapter Adapter number (N in /dev/i2c-N)
+ * @see MPU6050_ADDRESS_AD0_LOW
+ * @see MPU6050_ADDRESS_AD0_HIGH
+ */
+MPU6050::MPU6050(uint8_t address, uint8_t adapter) {
+    devAddr = I2CBUS_ADDRESS(adapter, address);
+    streamRecord = 0;
+    streamLost = 0;
+    streamResyncs = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -66,10 +93,23 @@ MPU6050::MPU6050(uint8_t address) {
  * the default internal clock source.
  */
 void MPU6050::initialize() {
-    setClockSource(MPU6050_CLOCK_PLL_XGYRO);
-    setFullScaleGyroRange(MPU6050_GYRO_FS_250);
-    setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
-    setSleepEnabled(false); // thanks to Jack Elston for pointing this one out!
+    // Equivalent to setClockSource(), setFullScaleGyroRange(),
+    // setFullScaleAccelRange() and setSleepEnabled(false), but with the three
+    // registers read in one transaction and written back in a second one.
+    I2Ctransaction transaction;
+    transaction.readByte(devAddr, MPU6050_RA_GYRO_CONFIG, buffer);
+    transaction.readByte(devAddr, MPU6050_RA_ACCEL_CONFIG, buffer + 1);
+    transaction.readByte(devAddr, MPU6050_RA_PWR_MGMT_1, buffer + 2);
+    if (!transaction.submit()) return;
+
+    buffer[0] = I2Cfield<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH>::insert(buffer[0], MPU6050_GYRO_FS_250);
+    buffer[1] = I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH>::insert(buffer[1], MPU6050_ACCEL_FS_2);
+    buffer[2] = I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>::insert(buffer[2], MPU6050_CLOCK_PLL_XGYRO);
+    buffer[2] = I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT>::insert(buffer[2], 0); // thanks to Jack Elston for pointing this one out!
+    transaction.writeByte(devAddr, MPU6050_RA_GYRO_CONFIG, buffer[0]);
+    transaction.writeByte(devAddr, MPU6050_RA_ACCEL_CONFIG, buffer[1]);
+    transaction.writeByte(devAddr, MPU6050_RA_PWR_MGMT_1, buffer[2]);
+    transaction.submit();
 }
 
 /** Verify the I2C connection.
@@ -80,6 +120,78 @@ bool MPU6050::testConnection() {
     return getDeviceID() == 0x34;
 }
 
+/** Enable or disable the shadow register cache for this device.
+ * While enabled, setters that change only some bits of a register start from
+ * the last value read or written instead of reading the register back first.
+ * Registers the device changes by itself (I2C master and interrupt status,
+ * sensor data, self-clearing reset bits, DMP memory and FIFO ports) are never
+ * cached.
+ * @param enabled True to shadow configuration registers, false to drop the cache
+ * @see I2Ccache
+ */
+void MPU6050::setRegisterCacheEnabled(bool enabled) {
+    if (!enabled) {
+        I2Ccache::disable(devAddr);
+        return;
+    }
+    I2Ccache::enable(devAddr);
+    I2Ccache::setVolatile(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_RA_I2C_MST_STATUS);
+    I2Ccache::setVolatile(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_RA_MOT_DETECT_STATUS);
+    I2Ccache::setVolatile(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_RA_SIGNAL_PATH_RESET);
+    I2Ccache::setVolatile(devAddr, MPU6050_RA_USER_CTRL, MPU6050_RA_USER_CTRL);
+    I2Ccache::setVolatile(devAddr, MPU6050_RA_BANK_SEL, MPU6050_RA_FIFO_R_W);
+}
+/** Enable or disable write-back register buffering for this device.
+ * While enabled, setters only update the shadow register cache (enabled as
+ * needed) and flushRegisters() writes each changed register once, adjacent
+ * ones in one burst, so e.g. setXGyroFIFOEnabled(), setYGyroFIFOEnabled()
+ * and setZGyroFIFOEnabled() together cost a single write of FIFO_EN. Getters
+ * already see the buffered values. Registers that are never cached (see
+ * setRegisterCacheEnabled()) are still written at once, after a flush.
+ * @param enabled True to buffer writes, false to flush and write through
+ * @see I2Ccache::setWriteBack()
+ */
+void MPU6050::setRegisterWriteBackEnabled(bool enabled) {
+    if (enabled && !I2Ccache::enabled(devAddr)) setRegisterCacheEnabled(true);
+    I2Ccache::setWriteBack(devAddr, enabled);
+}
+/** Write every register changed since the last flush.
+ * Registers reach the device in address order.
+ * @return Status of operation (true = success)
+ */
+bool MPU6050::flushRegisters() {
+    return I2Ccache::flush(devAddr);
+}
+
+/** Enable or disable per-tick read coalescing for this device.
+ * While enabled, reads made between two I2Ccoalesce::tick() calls are served
+ * from one snapshot, fetched in as few bursts as the previous tick's reads
+ * allow, so e.g. getAccelerationX(), getTemperature() and getRotationX() in
+ * one loop pass cost a single transaction. Clear-on-read status registers and
+ * the DMP memory and FIFO ports are always read as asked.
+ * @param enabled True to coalesce reads, false to read every register directly
+ * @see I2Ccoalesce
+ */
+void MPU6050::setReadCoalescingEnabled(bool enabled) {
+    if (!enabled) {
+        I2Ccoalesce::disable(devAddr);
+        return;
+    }
+    I2Ccoalesce::enable(devAddr);
+    I2Ccoalesce::setExcluded(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_RA_I2C_MST_STATUS);
+    I2Ccoalesce::setExcluded(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_RA_INT_STATUS);
+    I2Ccoalesce::setExcluded(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_RA_MOT_DETECT_STATUS);
+    I2Ccoalesce::setExcluded(devAddr, MPU6050_RA_BANK_SEL, MPU6050_RA_FIFO_R_W);
+}
+/** Re-read every cached register from the device.
+ * Use this if something other than this class may have changed the device
+ * configuration (another process, a brown-out).
+ * @return Status of operation (true = success)
+ */
+bool MPU6050::resyncRegisterCache() {
+    return I2Ccache::resync(devAddr);
+}
+
 // AUX_VDDIO register (InvenSense demo code calls this RA_*G_OFFS_TC)
 
 /** Get the auxiliary I2C supply voltage level.
@@ -89,7 +201,7 @@ bool MPU6050::testConnection() {
  * @return I2C supply voltage level (0=VLOGIC, 1=VDD)
  */
 uint8_t MPU6050::getAuxVDDIOLevel() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT, buffer);
+    I2Cfield<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set the auxiliary I2C supply voltage level.
@@ -99,7 +211,7 @@ uint8_t MPU6050::getAuxVDDIOLevel() {
  * @param level I2C supply voltage level (0=VLOGIC, 1=VDD)
  */
 void MPU6050::setAuxVDDIOLevel(uint8_t level) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT, level);
+    I2Cfield<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT>::write(devAddr, level);
 }
 
 // SMPLRT_DIV register
@@ -168,7 +280,7 @@ void MPU6050::setRate(uint8_t rate) {
  * @return FSYNC configuration value
  */
 uint8_t MPU6050::getExternalFrameSync() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set external FSYNC configuration.
@@ -177,7 +289,7 @@ uint8_t MPU6050::getExternalFrameSync() {
  * @param sync New FSYNC configuration value
  */
 void MPU6050::setExternalFrameSync(uint8_t sync) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH, sync);
+    I2Cfield<MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH>::write(devAddr, sync);
 }
 /** Get digital low-pass filter configuration.
  * The DLPF_CFG parameter sets the digital low pass filter configuration. It
@@ -208,7 +320,7 @@ void MPU6050::setExternalFrameSync(uint8_t sync) {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 uint8_t MPU6050::getDLPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set digital low-pass filter configuration.
@@ -220,7 +332,7 @@ uint8_t MPU6050::getDLPFMode() {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 void MPU6050::setDLPFMode(uint8_t mode) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, mode);
+    I2Cfield<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH>::write(devAddr, mode);
 }
 
 // GYRO_CONFIG register
@@ -243,7 +355,7 @@ void MPU6050::setDLPFMode(uint8_t mode) {
  * @see MPU6050_GCONFIG_FS_SEL_LENGTH
  */
 uint8_t MPU6050::getFullScaleGyroRange() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set full-scale gyroscope range.
@@ -255,7 +367,7 @@ uint8_t MPU6050::getFullScaleGyroRange() {
  * @see MPU6050_GCONFIG_FS_SEL_LENGTH
  */
 void MPU6050::setFullScaleGyroRange(uint8_t range) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, range);
+    I2Cfield<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH>::write(devAddr, range);
 }
 
 // ACCEL_CONFIG register
@@ -265,7 +377,7 @@ void MPU6050::setFullScaleGyroRange(uint8_t range) {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050::getAccelXSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT, buffer);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get self-test enabled setting for accelerometer X axis.
@@ -273,14 +385,14 @@ bool MPU6050::getAccelXSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setAccelXSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT, enabled);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT>::write(devAddr, enabled);
 }
 /** Get self-test enabled value for accelerometer Y axis.
  * @return Self-test enabled value
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050::getAccelYSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT, buffer);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get self-test enabled value for accelerometer Y axis.
@@ -288,14 +400,14 @@ bool MPU6050::getAccelYSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setAccelYSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT, enabled);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT>::write(devAddr, enabled);
 }
 /** Get self-test enabled value for accelerometer Z axis.
  * @return Self-test enabled value
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050::getAccelZSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT, buffer);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set self-test enabled value for accelerometer Z axis.
@@ -303,7 +415,7 @@ bool MPU6050::getAccelZSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setAccelZSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT, enabled);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT>::write(devAddr, enabled);
 }
 /** Get full-scale accelerometer range.
  * The FS_SEL parameter allows setting the full-scale range of the accelerometer
@@ -323,7 +435,7 @@ void MPU6050::setAccelZSelfTest(bool enabled) {
  * @see MPU6050_ACONFIG_AFS_SEL_LENGTH
  */
 uint8_t MPU6050::getFullScaleAccelRange() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set full-scale accelerometer range.
@@ -331,7 +443,7 @@ uint8_t MPU6050::getFullScaleAccelRange() {
  * @see getFullScaleAccelRange()
  */
 void MPU6050::setFullScaleAccelRange(uint8_t range) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, range);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH>::write(devAddr, range);
 }
 /** Get the high-pass filter configuration.
  * The DHPF is a filter module in the path leading to motion detectors (Free
@@ -369,7 +481,7 @@ void MPU6050::setFullScaleAccelRange(uint8_t range) {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 uint8_t MPU6050::getDHPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set the high-pass filter configuration.
@@ -379,7 +491,7 @@ uint8_t MPU6050::getDHPFMode() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setDHPFMode(uint8_t bandwidth) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, bandwidth);
+    I2Cfield<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH>::write(devAddr, bandwidth);
 }
 
 // FF_THR register
@@ -588,7 +700,7 @@ void MPU6050::setZeroMotionDetectionDuration(uint8_t duration) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getTempFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set temperature FIFO enabled value.
@@ -597,7 +709,7 @@ bool MPU6050::getTempFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setTempFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get gyroscope X-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_XOUT_H and GYRO_XOUT_L (Registers 67 and
@@ -606,7 +718,7 @@ void MPU6050::setTempFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getXGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set gyroscope X-axis FIFO enabled value.
@@ -615,7 +727,7 @@ bool MPU6050::getXGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setXGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get gyroscope Y-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_YOUT_H and GYRO_YOUT_L (Registers 69 and
@@ -624,7 +736,7 @@ void MPU6050::setXGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getYGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set gyroscope Y-axis FIFO enabled value.
@@ -633,7 +745,7 @@ bool MPU6050::getYGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setYGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get gyroscope Z-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_ZOUT_H and GYRO_ZOUT_L (Registers 71 and
@@ -642,7 +754,7 @@ void MPU6050::setYGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getZGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set gyroscope Z-axis FIFO enabled value.
@@ -651,7 +763,7 @@ bool MPU6050::getZGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setZGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get accelerometer FIFO enabled value.
  * When set to 1, this bit enables ACCEL_XOUT_H, ACCEL_XOUT_L, ACCEL_YOUT_H,
@@ -661,7 +773,7 @@ void MPU6050::setZGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getAccelFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set accelerometer FIFO enabled value.
@@ -670,7 +782,7 @@ bool MPU6050::getAccelFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setAccelFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get Slave 2 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -679,7 +791,7 @@ void MPU6050::setAccelFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getSlave2FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 2 FIFO enabled value.
@@ -688,7 +800,7 @@ bool MPU6050::getSlave2FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setSlave2FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get Slave 1 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -697,7 +809,7 @@ void MPU6050::setSlave2FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getSlave1FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 1 FIFO enabled value.
@@ -706,7 +818,7 @@ bool MPU6050::getSlave1FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setSlave1FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get Slave 0 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -715,7 +827,7 @@ void MPU6050::setSlave1FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getSlave0FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 0 FIFO enabled value.
@@ -724,7 +836,7 @@ bool MPU6050::getSlave0FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setSlave0FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 
 // I2C_MST_CTRL register
@@ -745,7 +857,7 @@ void MPU6050::setSlave0FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050::getMultiMasterEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set multi-master enabled value.
@@ -754,7 +866,7 @@ bool MPU6050::getMultiMasterEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setMultiMasterEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT>::write(devAddr, enabled);
 }
 /** Get wait-for-external-sensor-data enabled value.
  * When the WAIT_FOR_ES bit is set to 1, the Data Ready interrupt will be
@@ -768,7 +880,7 @@ void MPU6050::setMultiMasterEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050::getWaitForExternalSensorEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set wait-for-external-sensor-data enabled value.
@@ -777,7 +889,7 @@ bool MPU6050::getWaitForExternalSensorEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setWaitForExternalSensorEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT, enabled);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT>::write(devAddr, enabled);
 }
 /** Get Slave 3 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -786,7 +898,7 @@ void MPU6050::setWaitForExternalSensorEnabled(bool enabled) {
  * @see MPU6050_RA_MST_CTRL
  */
 bool MPU6050::getSlave3FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 3 FIFO enabled value.
@@ -795,7 +907,7 @@ bool MPU6050::getSlave3FIFOEnabled() {
  * @see MPU6050_RA_MST_CTRL
  */
 void MPU6050::setSlave3FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get slave read/write transition enabled value.
  * The I2C_MST_P_NSR bit configures the I2C Master's transition from one slave
@@ -808,7 +920,7 @@ void MPU6050::setSlave3FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050::getSlaveReadWriteTransitionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set slave read/write transition enabled value.
@@ -817,7 +929,7 @@ bool MPU6050::getSlaveReadWriteTransitionEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setSlaveReadWriteTransitionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT, enabled);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT>::write(devAddr, enabled);
 }
 /** Get I2C master clock speed.
  * I2C_MST_CLK is a 4 bit unsigned value which configures a divider on the
@@ -849,7 +961,7 @@ void MPU6050::setSlaveReadWriteTransitionEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 uint8_t MPU6050::getMasterClockSpeed() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C master clock speed.
@@ -857,7 +969,7 @@ uint8_t MPU6050::getMasterClockSpeed() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setMasterClockSpeed(uint8_t speed) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, speed);
+    I2Cfield<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH>::write(devAddr, speed);
 }
 
 // I2C_SLV* registers (Slave 0-3)
@@ -953,7 +1065,7 @@ void MPU6050::setSlaveRegister(uint8_t num, uint8_t reg) {
  */
 bool MPU6050::getSlaveEnabled(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_EN_BIT, buffer);
+    I2Cbits<MPU6050_I2C_SLV_EN_BIT>::read(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, buffer);
     return buffer[0];
 }
 /** Set the enabled value for the specified slave (0-3).
@@ -964,7 +1076,7 @@ bool MPU6050::getSlaveEnabled(uint8_t num) {
  */
 void MPU6050::setSlaveEnabled(uint8_t num, bool enabled) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_EN_BIT, enabled);
+    I2Cbits<MPU6050_I2C_SLV_EN_BIT>::write(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, enabled);
 }
 /** Get word pair byte-swapping enabled for the specified slave (0-3).
  * When set to 1, this bit enables byte swapping. When byte swapping is enabled,
@@ -979,7 +1091,7 @@ void MPU6050::setSlaveEnabled(uint8_t num, bool enabled) {
  */
 bool MPU6050::getSlaveWordByteSwap(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_BYTE_SW_BIT, buffer);
+    I2Cbits<MPU6050_I2C_SLV_BYTE_SW_BIT>::read(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, buffer);
     return buffer[0];
 }
 /** Set word pair byte-swapping enabled for the specified slave (0-3).
@@ -990,7 +1102,7 @@ bool MPU6050::getSlaveWordByteSwap(uint8_t num) {
  */
 void MPU6050::setSlaveWordByteSwap(uint8_t num, bool enabled) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_BYTE_SW_BIT, enabled);
+    I2Cbits<MPU6050_I2C_SLV_BYTE_SW_BIT>::write(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, enabled);
 }
 /** Get write mode for the specified slave (0-3).
  * When set to 1, the transaction will read or write data only. When cleared to
@@ -1004,7 +1116,7 @@ void MPU6050::setSlaveWordByteSwap(uint8_t num, bool enabled) {
  */
 bool MPU6050::getSlaveWriteMode(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_REG_DIS_BIT, buffer);
+    I2Cbits<MPU6050_I2C_SLV_REG_DIS_BIT>::read(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, buffer);
     return buffer[0];
 }
 /** Set write mode for the specified slave (0-3).
@@ -1015,7 +1127,7 @@ bool MPU6050::getSlaveWriteMode(uint8_t num) {
  */
 void MPU6050::setSlaveWriteMode(uint8_t num, bool mode) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_REG_DIS_BIT, mode);
+    I2Cbits<MPU6050_I2C_SLV_REG_DIS_BIT>::write(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, mode);
 }
 /** Get word pair grouping order offset for the specified slave (0-3).
  * This sets specifies the grouping order of word pairs received from registers.
@@ -1030,7 +1142,7 @@ void MPU6050::setSlaveWriteMode(uint8_t num, bool mode) {
  */
 bool MPU6050::getSlaveWordGroupOffset(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_GRP_BIT, buffer);
+    I2Cbits<MPU6050_I2C_SLV_GRP_BIT>::read(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, buffer);
     return buffer[0];
 }
 /** Set word pair grouping order offset for the specified slave (0-3).
@@ -1041,7 +1153,7 @@ bool MPU6050::getSlaveWordGroupOffset(uint8_t num) {
  */
 void MPU6050::setSlaveWordGroupOffset(uint8_t num, bool enabled) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_GRP_BIT, enabled);
+    I2Cbits<MPU6050_I2C_SLV_GRP_BIT>::write(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, enabled);
 }
 /** Get number of bytes to read for the specified slave (0-3).
  * Specifies the number of bytes transferred to and from Slave 0. Clearing this
@@ -1052,7 +1164,7 @@ void MPU6050::setSlaveWordGroupOffset(uint8_t num, bool enabled) {
  */
 uint8_t MPU6050::getSlaveDataLength(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH, buffer);
+    I2Cbits<MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH>::read(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, buffer);
     return buffer[0];
 }
 /** Set number of bytes to read for the specified slave (0-3).
@@ -1063,7 +1175,7 @@ uint8_t MPU6050::getSlaveDataLength(uint8_t num) {
  */
 void MPU6050::setSlaveDataLength(uint8_t num, uint8_t length) {
     if (num > 3) return;
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH, length);
+    I2Cbits<MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH>::write(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, length);
 }
 
 // I2C_SLV* registers (Slave 4)
@@ -1124,7 +1236,7 @@ void MPU6050::setSlave4OutputByte(uint8_t data) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050::getSlave4Enabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set the enabled value for Slave 4.
@@ -1133,7 +1245,7 @@ bool MPU6050::getSlave4Enabled() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT>::write(devAddr, enabled);
 }
 /** Get the enabled value for Slave 4 transaction interrupts.
  * When set to 1, this bit enables the generation of an interrupt signal upon
@@ -1145,7 +1257,7 @@ void MPU6050::setSlave4Enabled(bool enabled) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050::getSlave4InterruptEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set the enabled value for Slave 4 transaction interrupts.
@@ -1154,7 +1266,7 @@ bool MPU6050::getSlave4InterruptEnabled() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4InterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT>::write(devAddr, enabled);
 }
 /** Get write mode for Slave 4.
  * When set to 1, the transaction will read or write data only. When cleared to
@@ -1166,7 +1278,7 @@ void MPU6050::setSlave4InterruptEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050::getSlave4WriteMode() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set write mode for the Slave 4.
@@ -1175,7 +1287,7 @@ bool MPU6050::getSlave4WriteMode() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4WriteMode(bool mode) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT, mode);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT>::write(devAddr, mode);
 }
 /** Get Slave 4 master delay value.
  * This configures the reduced access rate of I2C slaves relative to the Sample
@@ -1193,7 +1305,7 @@ void MPU6050::setSlave4WriteMode(bool mode) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 uint8_t MPU6050::getSlave4MasterDelay() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 4 master delay value.
@@ -1202,7 +1314,7 @@ uint8_t MPU6050::getSlave4MasterDelay() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4MasterDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, delay);
+    I2Cfield<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH>::write(devAddr, delay);
 }
 /** Get last available byte read from Slave 4.
  * This register stores the data read from Slave 4. This field is populated
@@ -1227,7 +1339,7 @@ uint8_t MPU6050::getSlate4InputByte() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getPassthroughStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_PASS_THROUGH_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_PASS_THROUGH_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 4 transaction done status.
@@ -1239,7 +1351,7 @@ bool MPU6050::getPassthroughStatus() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave4IsDone() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_DONE_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_DONE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get master arbitration lost status.
@@ -1250,7 +1362,7 @@ bool MPU6050::getSlave4IsDone() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getLostArbitration() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_LOST_ARB_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_LOST_ARB_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 4 NACK status.
@@ -1261,7 +1373,7 @@ bool MPU6050::getLostArbitration() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave4Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_NACK_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_NACK_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 3 NACK status.
@@ -1272,7 +1384,7 @@ bool MPU6050::getSlave4Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave3Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV3_NACK_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV3_NACK_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 2 NACK status.
@@ -1283,7 +1395,7 @@ bool MPU6050::getSlave3Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave2Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV2_NACK_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV2_NACK_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 1 NACK status.
@@ -1294,7 +1406,7 @@ bool MPU6050::getSlave2Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave1Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV1_NACK_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV1_NACK_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 0 NACK status.
@@ -1305,7 +1417,7 @@ bool MPU6050::getSlave1Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave0Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV0_NACK_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV0_NACK_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1318,7 +1430,7 @@ bool MPU6050::getSlave0Nack() {
  * @see MPU6050_INTCFG_INT_LEVEL_BIT
  */
 bool MPU6050::getInterruptMode() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt logic level mode.
@@ -1328,7 +1440,7 @@ bool MPU6050::getInterruptMode() {
  * @see MPU6050_INTCFG_INT_LEVEL_BIT
  */
 void MPU6050::setInterruptMode(bool mode) {
-   I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT, mode);
+   I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT>::write(devAddr, mode);
 }
 /** Get interrupt drive mode.
  * Will be set 0 for push-pull, 1 for open-drain.
@@ -1337,7 +1449,7 @@ void MPU6050::setInterruptMode(bool mode) {
  * @see MPU6050_INTCFG_INT_OPEN_BIT
  */
 bool MPU6050::getInterruptDrive() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt drive mode.
@@ -1347,7 +1459,7 @@ bool MPU6050::getInterruptDrive() {
  * @see MPU6050_INTCFG_INT_OPEN_BIT
  */
 void MPU6050::setInterruptDrive(bool drive) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT, drive);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT>::write(devAddr, drive);
 }
 /** Get interrupt latch mode.
  * Will be set 0 for 50us-pulse, 1 for latch-until-int-cleared.
@@ -1356,7 +1468,7 @@ void MPU6050::setInterruptDrive(bool drive) {
  * @see MPU6050_INTCFG_LATCH_INT_EN_BIT
  */
 bool MPU6050::getInterruptLatch() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt latch mode.
@@ -1366,7 +1478,7 @@ bool MPU6050::getInterruptLatch() {
  * @see MPU6050_INTCFG_LATCH_INT_EN_BIT
  */
 void MPU6050::setInterruptLatch(bool latch) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT, latch);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT>::write(devAddr, latch);
 }
 /** Get interrupt latch clear mode.
  * Will be set 0 for status-read-only, 1 for any-register-read.
@@ -1375,7 +1487,7 @@ void MPU6050::setInterruptLatch(bool latch) {
  * @see MPU6050_INTCFG_INT_RD_CLEAR_BIT
  */
 bool MPU6050::getInterruptLatchClear() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt latch clear mode.
@@ -1385,7 +1497,7 @@ bool MPU6050::getInterruptLatchClear() {
  * @see MPU6050_INTCFG_INT_RD_CLEAR_BIT
  */
 void MPU6050::setInterruptLatchClear(bool clear) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT, clear);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT>::write(devAddr, clear);
 }
 /** Get FSYNC interrupt logic level mode.
  * @return Current FSYNC interrupt mode (0=active-high, 1=active-low)
@@ -1394,7 +1506,7 @@ void MPU6050::setInterruptLatchClear(bool clear) {
  * @see MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT
  */
 bool MPU6050::getFSyncInterruptLevel() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set FSYNC interrupt logic level mode.
@@ -1404,7 +1516,7 @@ bool MPU6050::getFSyncInterruptLevel() {
  * @see MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT
  */
 void MPU6050::setFSyncInterruptLevel(bool level) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT, level);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT>::write(devAddr, level);
 }
 /** Get FSYNC pin interrupt enabled setting.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1413,7 +1525,7 @@ void MPU6050::setFSyncInterruptLevel(bool level) {
  * @see MPU6050_INTCFG_FSYNC_INT_EN_BIT
  */
 bool MPU6050::getFSyncInterruptEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set FSYNC pin interrupt enabled setting.
@@ -1423,7 +1535,7 @@ bool MPU6050::getFSyncInterruptEnabled() {
  * @see MPU6050_INTCFG_FSYNC_INT_EN_BIT
  */
 void MPU6050::setFSyncInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT>::write(devAddr, enabled);
 }
 /** Get I2C bypass enabled status.
  * When this bit is equal to 1 and I2C_MST_EN (Register 106 bit[5]) is equal to
@@ -1437,7 +1549,7 @@ void MPU6050::setFSyncInterruptEnabled(bool enabled) {
  * @see MPU6050_INTCFG_I2C_BYPASS_EN_BIT
  */
 bool MPU6050::getI2CBypassEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C bypass enabled status.
@@ -1452,7 +1564,7 @@ bool MPU6050::getI2CBypassEnabled() {
  * @see MPU6050_INTCFG_I2C_BYPASS_EN_BIT
  */
 void MPU6050::setI2CBypassEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT>::write(devAddr, enabled);
 }
 /** Get reference clock output enabled status.
  * When this bit is equal to 1, a reference clock output is provided at the
@@ -1464,7 +1576,7 @@ void MPU6050::setI2CBypassEnabled(bool enabled) {
  * @see MPU6050_INTCFG_CLKOUT_EN_BIT
  */
 bool MPU6050::getClockOutputEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set reference clock output enabled status.
@@ -1477,7 +1589,7 @@ bool MPU6050::getClockOutputEnabled() {
  * @see MPU6050_INTCFG_CLKOUT_EN_BIT
  */
 void MPU6050::setClockOutputEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT>::write(devAddr, enabled);
 }
 
 // INT_ENABLE register
@@ -1511,7 +1623,7 @@ void MPU6050::setIntEnabled(uint8_t enabled) {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 bool MPU6050::getIntFreefallEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Free Fall interrupt enabled status.
@@ -1521,7 +1633,7 @@ bool MPU6050::getIntFreefallEnabled() {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 void MPU6050::setIntFreefallEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT>::write(devAddr, enabled);
 }
 /** Get Motion Detection interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1530,7 +1642,7 @@ void MPU6050::setIntFreefallEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_MOT_BIT
  **/
 bool MPU6050::getIntMotionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Motion Detection interrupt enabled status.
@@ -1540,7 +1652,7 @@ bool MPU6050::getIntMotionEnabled() {
  * @see MPU6050_INTERRUPT_MOT_BIT
  **/
 void MPU6050::setIntMotionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT>::write(devAddr, enabled);
 }
 /** Get Zero Motion Detection interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1549,7 +1661,7 @@ void MPU6050::setIntMotionEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  **/
 bool MPU6050::getIntZeroMotionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Zero Motion Detection interrupt enabled status.
@@ -1559,7 +1671,7 @@ bool MPU6050::getIntZeroMotionEnabled() {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  **/
 void MPU6050::setIntZeroMotionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT>::write(devAddr, enabled);
 }
 /** Get FIFO Buffer Overflow interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1568,7 +1680,7 @@ void MPU6050::setIntZeroMotionEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  **/
 bool MPU6050::getIntFIFOBufferOverflowEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set FIFO Buffer Overflow interrupt enabled status.
@@ -1578,7 +1690,7 @@ bool MPU6050::getIntFIFOBufferOverflowEnabled() {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  **/
 void MPU6050::setIntFIFOBufferOverflowEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT>::write(devAddr, enabled);
 }
 /** Get I2C Master interrupt enabled status.
  * This enables any of the I2C Master interrupt sources to generate an
@@ -1588,7 +1700,7 @@ void MPU6050::setIntFIFOBufferOverflowEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  **/
 bool MPU6050::getIntI2CMasterEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C Master interrupt enabled status.
@@ -1598,7 +1710,7 @@ bool MPU6050::getIntI2CMasterEnabled() {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  **/
 void MPU6050::setIntI2CMasterEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT>::write(devAddr, enabled);
 }
 /** Get Data Ready interrupt enabled setting.
  * This event occurs each time a write operation to all of the sensor registers
@@ -1608,7 +1720,7 @@ void MPU6050::setIntI2CMasterEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 bool MPU6050::getIntDataReadyEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Data Ready interrupt enabled status.
@@ -1618,7 +1730,7 @@ bool MPU6050::getIntDataReadyEnabled() {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 void MPU6050::setIntDataReadyEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT>::write(devAddr, enabled);
 }
 
 // INT_STATUS register
@@ -1642,7 +1754,7 @@ uint8_t MPU6050::getIntStatus() {
  * @see MPU6050_INTERRUPT_FF_BIT
  */
 bool MPU6050::getIntFreefallStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FF_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FF_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Motion Detection interrupt status.
@@ -1653,7 +1765,7 @@ bool MPU6050::getIntFreefallStatus() {
  * @see MPU6050_INTERRUPT_MOT_BIT
  */
 bool MPU6050::getIntMotionStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_MOT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_MOT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Zero Motion Detection interrupt status.
@@ -1664,7 +1776,7 @@ bool MPU6050::getIntMotionStatus() {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  */
 bool MPU6050::getIntZeroMotionStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_ZMOT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_ZMOT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get FIFO Buffer Overflow interrupt status.
@@ -1675,7 +1787,7 @@ bool MPU6050::getIntZeroMotionStatus() {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  */
 bool MPU6050::getIntFIFOBufferOverflowStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FIFO_OFLOW_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get I2C Master interrupt status.
@@ -1687,7 +1799,7 @@ bool MPU6050::getIntFIFOBufferOverflowStatus() {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  */
 bool MPU6050::getIntI2CMasterStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_I2C_MST_INT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_I2C_MST_INT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Data Ready interrupt status.
@@ -1698,7 +1810,7 @@ bool MPU6050::getIntI2CMasterStatus() {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 bool MPU6050::getIntDataReadyStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DATA_RDY_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DATA_RDY_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1725,7 +1837,10 @@ void MPU6050::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
     // TODO: magnetometer integration
 }
 /** Get raw 6-axis motion sensor readings (accel/gyro).
- * Retrieves all currently available motion sensor values.
+ * Retrieves all currently available motion sensor values. The 14 registers
+ * are fetched in a single combined I2C transaction, so all axes come from the
+ * same sampling instant. The read is in the urgent I2Cbus priority class, so
+ * it gets the bus ahead of bulk transfers queued by other threads.
  * @param ax 16-bit signed integer container for accelerometer X-axis value
  * @param ay 16-bit signed integer container for accelerometer Y-axis value
  * @param az 16-bit signed integer container for accelerometer Z-axis value
@@ -1737,6 +1852,7 @@ void MPU6050::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
+    I2Cpriority urgent(I2CBUS_PRIORITY_URGENT);
     I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, buffer);
     *ax = (((int16_t)buffer[0]) << 8) | buffer[1];
     *ay = (((int16_t)buffer[2]) << 8) | buffer[3];
@@ -2001,7 +2117,7 @@ uint32_t MPU6050::getExternalSensorDWord(int position) {
  * @see MPU6050_MOTION_MOT_XNEG_BIT
  */
 bool MPU6050::getXNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XNEG_BIT, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XNEG_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get X-axis positive motion detection interrupt status.
@@ -2010,7 +2126,7 @@ bool MPU6050::getXNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_XPOS_BIT
  */
 bool MPU6050::getXPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XPOS_BIT, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XPOS_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Y-axis negative motion detection interrupt status.
@@ -2019,7 +2135,7 @@ bool MPU6050::getXPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_YNEG_BIT
  */
 bool MPU6050::getYNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YNEG_BIT, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YNEG_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Y-axis positive motion detection interrupt status.
@@ -2028,7 +2144,7 @@ bool MPU6050::getYNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_YPOS_BIT
  */
 bool MPU6050::getYPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YPOS_BIT, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YPOS_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Z-axis negative motion detection interrupt status.
@@ -2037,7 +2153,7 @@ bool MPU6050::getYPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZNEG_BIT
  */
 bool MPU6050::getZNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZNEG_BIT, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZNEG_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get Z-axis positive motion detection interrupt status.
@@ -2046,7 +2162,7 @@ bool MPU6050::getZNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZPOS_BIT
  */
 bool MPU6050::getZPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZPOS_BIT, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZPOS_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Get zero motion detection interrupt status.
@@ -2055,7 +2171,7 @@ bool MPU6050::getZPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZRMOT_BIT
  */
 bool MPU6050::getZeroMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZRMOT_BIT, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZRMOT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -2085,7 +2201,7 @@ void MPU6050::setSlaveOutputByte(uint8_t num, uint8_t data) {
  * @see MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT
  */
 bool MPU6050::getExternalShadowDelayEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT, buffer);
+    I2Cfield<MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set external data shadow delay enabled status.
@@ -2095,7 +2211,7 @@ bool MPU6050::getExternalShadowDelayEnabled() {
  * @see MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT
  */
 void MPU6050::setExternalShadowDelayEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT, enabled);
+    I2Cfield<MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT>::write(devAddr, enabled);
 }
 /** Get slave delay enabled status.
  * When a particular slave delay is enabled, the rate of access for the that
@@ -2140,7 +2256,7 @@ void MPU6050::setSlaveDelayEnabled(uint8_t num, bool enabled) {
  * @see MPU6050_PATHRESET_GYRO_RESET_BIT
  */
 void MPU6050::resetGyroscopePath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_GYRO_RESET_BIT, true);
+    I2Cfield<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_GYRO_RESET_BIT>::write(devAddr, true);
 }
 /** Reset accelerometer signal path.
  * The reset will revert the signal path analog to digital converters and
@@ -2149,7 +2265,7 @@ void MPU6050::resetGyroscopePath() {
  * @see MPU6050_PATHRESET_ACCEL_RESET_BIT
  */
 void MPU6050::resetAccelerometerPath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_ACCEL_RESET_BIT, true);
+    I2Cfield<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_ACCEL_RESET_BIT>::write(devAddr, true);
 }
 /** Reset temperature sensor signal path.
  * The reset will revert the signal path analog to digital converters and
@@ -2158,7 +2274,7 @@ void MPU6050::resetAccelerometerPath() {
  * @see MPU6050_PATHRESET_TEMP_RESET_BIT
  */
 void MPU6050::resetTemperaturePath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_TEMP_RESET_BIT, true);
+    I2Cfield<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_TEMP_RESET_BIT>::write(devAddr, true);
 }
 
 // MOT_DETECT_CTRL register
@@ -2178,7 +2294,7 @@ void MPU6050::resetTemperaturePath() {
  * @see MPU6050_DETECT_ACCEL_ON_DELAY_BIT
  */
 uint8_t MPU6050::getAccelerometerPowerOnDelay() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set accelerometer power-on delay.
@@ -2188,7 +2304,7 @@ uint8_t MPU6050::getAccelerometerPowerOnDelay() {
  * @see MPU6050_DETECT_ACCEL_ON_DELAY_BIT
  */
 void MPU6050::setAccelerometerPowerOnDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH, delay);
+    I2Cfield<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH>::write(devAddr, delay);
 }
 /** Get Free Fall detection counter decrement configuration.
  * Detection is registered by the Free Fall detection module after accelerometer
@@ -2217,7 +2333,7 @@ void MPU6050::setAccelerometerPowerOnDelay(uint8_t delay) {
  * @see MPU6050_DETECT_FF_COUNT_BIT
  */
 uint8_t MPU6050::getFreefallDetectionCounterDecrement() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Free Fall detection counter decrement configuration.
@@ -2227,7 +2343,7 @@ uint8_t MPU6050::getFreefallDetectionCounterDecrement() {
  * @see MPU6050_DETECT_FF_COUNT_BIT
  */
 void MPU6050::setFreefallDetectionCounterDecrement(uint8_t decrement) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH, decrement);
+    I2Cfield<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH>::write(devAddr, decrement);
 }
 /** Get Motion detection counter decrement configuration.
  * Detection is registered by the Motion detection module after accelerometer
@@ -2253,7 +2369,7 @@ void MPU6050::setFreefallDetectionCounterDecrement(uint8_t decrement) {
  *
  */
 uint8_t MPU6050::getMotionDetectionCounterDecrement() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Motion detection counter decrement configuration.
@@ -2263,7 +2379,7 @@ uint8_t MPU6050::getMotionDetectionCounterDecrement() {
  * @see MPU6050_DETECT_MOT_COUNT_BIT
  */
 void MPU6050::setMotionDetectionCounterDecrement(uint8_t decrement) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, decrement);
+    I2Cfield<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH>::write(devAddr, decrement);
 }
 
 // USER_CTRL register
@@ -2277,7 +2393,7 @@ void MPU6050::setMotionDetectionCounterDecrement(uint8_t decrement) {
  * @see MPU6050_USERCTRL_FIFO_EN_BIT
  */
 bool MPU6050::getFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set FIFO enabled status.
@@ -2287,7 +2403,7 @@ bool MPU6050::getFIFOEnabled() {
  * @see MPU6050_USERCTRL_FIFO_EN_BIT
  */
 void MPU6050::setFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 /** Get I2C Master Mode enabled status.
  * When this mode is enabled, the MPU-60X0 acts as the I2C Master to the
@@ -2301,7 +2417,7 @@ void MPU6050::setFIFOEnabled(bool enabled) {
  * @see MPU6050_USERCTRL_I2C_MST_EN_BIT
  */
 bool MPU6050::getI2CMasterModeEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C Master Mode enabled status.
@@ -2311,14 +2427,14 @@ bool MPU6050::getI2CMasterModeEnabled() {
  * @see MPU6050_USERCTRL_I2C_MST_EN_BIT
  */
 void MPU6050::setI2CMasterModeEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT>::write(devAddr, enabled);
 }
 /** Switch from I2C to SPI mode (MPU-6000 only)
  * If this is set, the primary SPI interface will be enabled in place of the
  * disabled primary I2C interface.
  */
 void MPU6050::switchSPIEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_IF_DIS_BIT, enabled);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_IF_DIS_BIT>::write(devAddr, enabled);
 }
 /** Reset the FIFO.
  * This bit resets the FIFO buffer when set to 1 while FIFO_EN equals 0. This
@@ -2327,7 +2443,7 @@ void MPU6050::switchSPIEnabled(bool enabled) {
  * @see MPU6050_USERCTRL_FIFO_RESET_BIT
  */
 void MPU6050::resetFIFO() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT, true);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT>::write(devAddr, true);
 }
 /** Reset the I2C Master.
  * This bit resets the I2C Master when set to 1 while I2C_MST_EN equals 0.
@@ -2336,7 +2452,7 @@ void MPU6050::resetFIFO() {
  * @see MPU6050_USERCTRL_I2C_MST_RESET_BIT
  */
 void MPU6050::resetI2CMaster() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_RESET_BIT, true);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_RESET_BIT>::write(devAddr, true);
 }
 /** Reset all sensor registers and signal paths.
  * When set to 1, this bit resets the signal paths for all sensors (gyroscopes,
@@ -2351,7 +2467,7 @@ void MPU6050::resetI2CMaster() {
  * @see MPU6050_USERCTRL_SIG_COND_RESET_BIT
  */
 void MPU6050::resetSensors() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_SIG_COND_RESET_BIT, true);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_SIG_COND_RESET_BIT>::write(devAddr, true);
 }
 
 // PWR_MGMT_1 register
@@ -2362,7 +2478,10 @@ void MPU6050::resetSensors() {
  * @see MPU6050_PWR1_DEVICE_RESET_BIT
  */
 void MPU6050::reset() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT, true);
+    I2Ccache::flush(devAddr); // buffered writes belong before the reset
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT>::write(devAddr, true);
+    I2Ccache::flush(devAddr); // and the reset itself must not wait
+    I2Ccache::invalidate(devAddr); // every register is back at its power-on value
 }
 /** Get sleep mode status.
  * Setting the SLEEP bit in the register puts the device into very low power
@@ -2376,7 +2495,7 @@ void MPU6050::reset() {
  * @see MPU6050_PWR1_SLEEP_BIT
  */
 bool MPU6050::getSleepEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set sleep mode status.
@@ -2386,7 +2505,7 @@ bool MPU6050::getSleepEnabled() {
  * @see MPU6050_PWR1_SLEEP_BIT
  */
 void MPU6050::setSleepEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT>::write(devAddr, enabled);
 }
 /** Get wake cycle enabled status.
  * When this bit is set to 1 and SLEEP is disabled, the MPU-60X0 will cycle
@@ -2397,7 +2516,7 @@ void MPU6050::setSleepEnabled(bool enabled) {
  * @see MPU6050_PWR1_CYCLE_BIT
  */
 bool MPU6050::getWakeCycleEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set wake cycle enabled status.
@@ -2407,7 +2526,7 @@ bool MPU6050::getWakeCycleEnabled() {
  * @see MPU6050_PWR1_CYCLE_BIT
  */
 void MPU6050::setWakeCycleEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT>::write(devAddr, enabled);
 }
 /** Get temperature sensor enabled status.
  * Control the usage of the internal temperature sensor.
@@ -2421,7 +2540,7 @@ void MPU6050::setWakeCycleEnabled(bool enabled) {
  * @see MPU6050_PWR1_TEMP_DIS_BIT
  */
 bool MPU6050::getTempSensorEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT>::read(devAddr, buffer);
     return buffer[0] == 0; // 1 is actually disabled here
 }
 /** Set temperature sensor enabled status.
@@ -2436,7 +2555,7 @@ bool MPU6050::getTempSensorEnabled() {
  */
 void MPU6050::setTempSensorEnabled(bool enabled) {
     // 1 is actually disabled here
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT, !enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT>::write(devAddr, !enabled);
 }
 /** Get clock source setting.
  * @return Current clock source setting
@@ -2445,7 +2564,7 @@ void MPU6050::setTempSensorEnabled(bool enabled) {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 uint8_t MPU6050::getClockSource() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set clock source setting.
@@ -2479,7 +2598,7 @@ uint8_t MPU6050::getClockSource() {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 void MPU6050::setClockSource(uint8_t source) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, source);
+    I2Cfield<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>::write(devAddr, source);
 }
 
 // PWR_MGMT_2 register
@@ -2508,7 +2627,7 @@ void MPU6050::setClockSource(uint8_t source) {
  * @see MPU6050_RA_PWR_MGMT_2
  */
 uint8_t MPU6050::getWakeFrequency() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set wake frequency in Accel-Only Low Power Mode.
@@ -2516,7 +2635,7 @@ uint8_t MPU6050::getWakeFrequency() {
  * @see MPU6050_RA_PWR_MGMT_2
  */
 void MPU6050::setWakeFrequency(uint8_t frequency) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH, frequency);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH>::write(devAddr, frequency);
 }
 
 /** Get X-axis accelerometer standby enabled status.
@@ -2526,7 +2645,7 @@ void MPU6050::setWakeFrequency(uint8_t frequency) {
  * @see MPU6050_PWR2_STBY_XA_BIT
  */
 bool MPU6050::getStandbyXAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set X-axis accelerometer standby enabled status.
@@ -2536,7 +2655,7 @@ bool MPU6050::getStandbyXAccelEnabled() {
  * @see MPU6050_PWR2_STBY_XA_BIT
  */
 void MPU6050::setStandbyXAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT>::write(devAddr, enabled);
 }
 /** Get Y-axis accelerometer standby enabled status.
  * If enabled, the Y-axis will not gather or report data (or use power).
@@ -2545,7 +2664,7 @@ void MPU6050::setStandbyXAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_YA_BIT
  */
 bool MPU6050::getStandbyYAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Y-axis accelerometer standby enabled status.
@@ -2555,7 +2674,7 @@ bool MPU6050::getStandbyYAccelEnabled() {
  * @see MPU6050_PWR2_STBY_YA_BIT
  */
 void MPU6050::setStandbyYAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT>::write(devAddr, enabled);
 }
 /** Get Z-axis accelerometer standby enabled status.
  * If enabled, the Z-axis will not gather or report data (or use power).
@@ -2564,7 +2683,7 @@ void MPU6050::setStandbyYAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_ZA_BIT
  */
 bool MPU6050::getStandbyZAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Z-axis accelerometer standby enabled status.
@@ -2574,7 +2693,7 @@ bool MPU6050::getStandbyZAccelEnabled() {
  * @see MPU6050_PWR2_STBY_ZA_BIT
  */
 void MPU6050::setStandbyZAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT>::write(devAddr, enabled);
 }
 /** Get X-axis gyroscope standby enabled status.
  * If enabled, the X-axis will not gather or report data (or use power).
@@ -2583,7 +2702,7 @@ void MPU6050::setStandbyZAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_XG_BIT
  */
 bool MPU6050::getStandbyXGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set X-axis gyroscope standby enabled status.
@@ -2593,7 +2712,7 @@ bool MPU6050::getStandbyXGyroEnabled() {
  * @see MPU6050_PWR2_STBY_XG_BIT
  */
 void MPU6050::setStandbyXGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT>::write(devAddr, enabled);
 }
 /** Get Y-axis gyroscope standby enabled status.
  * If enabled, the Y-axis will not gather or report data (or use power).
@@ -2602,7 +2721,7 @@ void MPU6050::setStandbyXGyroEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_YG_BIT
  */
 bool MPU6050::getStandbyYGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Y-axis gyroscope standby enabled status.
@@ -2612,7 +2731,7 @@ bool MPU6050::getStandbyYGyroEnabled() {
  * @see MPU6050_PWR2_STBY_YG_BIT
  */
 void MPU6050::setStandbyYGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT>::write(devAddr, enabled);
 }
 /** Get Z-axis gyroscope standby enabled status.
  * If enabled, the Z-axis will not gather or report data (or use power).
@@ -2621,7 +2740,7 @@ void MPU6050::setStandbyYGyroEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_ZG_BIT
  */
 bool MPU6050::getStandbyZGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT, buffer);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Z-axis gyroscope standby enabled status.
@@ -2631,7 +2750,7 @@ bool MPU6050::getStandbyZGyroEnabled() {
  * @see MPU6050_PWR2_STBY_ZG_BIT
  */
 void MPU6050::setStandbyZGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT, enabled);
+    I2Cfield<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT>::write(devAddr, enabled);
 }
 
 // FIFO_COUNT* registers
@@ -2680,6 +2799,8 @@ uint8_t MPU6050::getFIFOByte() {
     return buffer[0];
 }
 void MPU6050::getFIFOBytes(uint8_t *data, uint8_t length) {
+    // draining the FIFO in time is what keeps it from overflowing
+    I2Cpriority urgent(I2CBUS_PRIORITY_URGENT);
     I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_R_W, length, data);
 }
 /** Write byte to FIFO buffer.
@@ -2690,6 +2811,183 @@ void MPU6050::setFIFOByte(uint8_t data) {
     I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_R_W, data);
 }
 
+// FIFO streaming
+
+/** Start collecting every sample in the FIFO.
+ * The FIFO is emptied and from then on takes one record of accelerometer and
+ * gyroscope readings (and the temperature, if asked for) per sample, at the
+ * rate set by the divider: 1 kHz / (1 + rate) with the DLPF on, 8 kHz / (1 +
+ * rate) with it off (see setDLPFMode(), which must be called first). Then
+ * readStream() picks up whole records as they come. No sample is read twice,
+ * and none is missed as long as readStream() runs before the 1024-byte FIFO
+ * fills up (about 85 ms at 1 kHz). Samples lost anyway are counted and
+ * reported, see readStream().
+ * @param rate New sample rate divider
+ * @param temperature True to stream the temperature as well
+ * @return Status of operation (true = success)
+ * @see readStream()
+ * @see setRate()
+ * @see MPU6050_RA_FIFO_EN
+ */
+bool MPU6050::startStream(uint8_t rate, bool temperature) {
+    uint8_t sources = (1 << MPU6050_XG_FIFO_EN_BIT) | (1 << MPU6050_YG_FIFO_EN_BIT) |
+        (1 << MPU6050_ZG_FIFO_EN_BIT) | (1 << MPU6050_ACCEL_FIFO_EN_BIT);
+    uint8_t dlpf;
+
+    if (temperature) sources |= 1 << MPU6050_TEMP_FIFO_EN_BIT;
+    streamRecord = 0;
+    if (I2Cfield<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH>::read(devAddr, &dlpf) <= 0) {
+        return false;
+    }
+    // stop filling before the FIFO_RESET, which only works with FIFO_EN off
+    if (!I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT>::write(devAddr, false)) return false;
+    if (!I2Cdev::writeByte(devAddr, MPU6050_RA_SMPLRT_DIV, rate)) return false;
+    if (!I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_EN, sources)) return false;
+    // in write-back mode the two writes above are still in the shadow
+    if (!I2Ccache::flush(devAddr)) return false;
+    if (!I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT>::write(devAddr, true)) return false;
+    if (!I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT>::write(devAddr, true)) return false;
+    // the gyroscope output rate is 8 kHz with the DLPF off (0 and 7), 1 kHz otherwise
+    streamPeriod = (dlpf == 0 || dlpf == 7 ? 125000 : 1000000) * (1 + (uint32_t)rate);
+    streamLast = monotonicNs();
+    streamSequence = 0;
+    streamPending = 0;
+    streamLost = 0;
+    streamResyncs = 0;
+    streamRecord = temperature ? MPU6050_STREAM_RECORD_TEMP : MPU6050_STREAM_RECORD;
+    return true;
+}
+/** Read the samples collected since the last call.
+ * Takes as many whole records as the FIFO holds, up to count, in two urgent
+ * transactions whatever their number: INT_STATUS with FIFO_COUNT, then one
+ * read of all the records from FIFO_R_W. A record still being written stays
+ * in the FIFO for the next call.
+ *
+ * Once the FIFO has overflowed (FIFO_OFLOW_INT) or holds a count that is not
+ * whole records, the device has dropped bytes and the records no longer start
+ * where the framing expects. The FIFO is then reset, without touching the
+ * rate or the sources, and the call returns no samples. The samples that were
+ * taken since the last one delivered are counted from the sample rate. The
+ * next sample carries their number in lost, and its sequence skips them.
+ * Timestamps are estimated back from the time of the FIFO_COUNT read, one
+ * sample period apart.
+ * @param samples Array to store the samples in, oldest first
+ * @param count Size of the array
+ * @return Number of samples stored (0 if none are waiting or the FIFO was
+ *         reset), -1 on failure or if the stream has not been started
+ * @see startStream()
+ * @see getStreamLost()
+ */
+int MPU6050::readStream(MPU6050sample *samples, int count) {
+    uint8_t data[MPU6050_FIFO_SIZE];
+    uint8_t status;
+    uint16_t fill;
+    uint64_t now;
+    int waiting, records;
+
+    if (streamRecord == 0) return -1;
+    I2Cpriority urgent(I2CBUS_PRIORITY_URGENT);
+    // INT_STATUS clears on read, so an overflow is reported exactly once
+    I2Ctransaction transaction;
+    transaction.readByte(devAddr, MPU6050_RA_INT_STATUS, &status);
+    transaction.once();
+    transaction.readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, data);
+    if (!transaction.submit()) return -1;
+    now = monotonicNs();
+    fill = (((uint16_t)data[0]) << 8) | data[1];
+    if ((status & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) || fill > MPU6050_FIFO_SIZE) {
+        return resyncStream(now) ? 0 : -1;
+    }
+    if (fill % streamRecord != 0) {
+        // caught a record half written, or the framing has slipped
+        if (I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, data) <= 0) return -1;
+        now = monotonicNs();
+        fill = (((uint16_t)data[0]) << 8) | data[1];
+        if (fill % streamRecord != 0) return resyncStream(now) ? 0 : -1;
+    }
+    waiting = fill / streamRecord;
+    records = waiting < count ? waiting : count;
+    if (records <= 0) return 0;
+    if (I2Cdev::readPort(devAddr, MPU6050_RA_FIFO_R_W, records * streamRecord, data) <= 0) return -1;
+
+    // records follow register order: ACCEL_*OUT, TEMP_OUT, GYRO_*OUT
+    for (int i = 0; i < records; i++) {
+        const uint8_t *record = data + i * streamRecord;
+        const uint8_t *gyro = record + streamRecord - 6;
+        samples[i].ax = (((int16_t)record[0]) << 8) | record[1];
+        samples[i].ay = (((int16_t)record[2]) << 8) | record[3];
+        samples[i].az = (((int16_t)record[4]) << 8) | record[5];
+        samples[i].temperature = streamRecord == MPU6050_STREAM_RECORD_TEMP ?
+            (((int16_t)record[6]) << 8) | record[7] : 0;
+        samples[i].gx = (((int16_t)gyro[0]) << 8) | gyro[1];
+        samples[i].gy = (((int16_t)gyro[2]) << 8) | gyro[3];
+        samples[i].gz = (((int16_t)gyro[4]) << 8) | gyro[5];
+        // the newest record waiting was taken within the last period
+        samples[i].timestamp = now - (uint64_t)(waiting - i) * streamPeriod + streamPeriod / 2;
+        samples[i].lost = streamPending;
+        streamSequence += streamPending;
+        samples[i].sequence = streamSequence++;
+        streamPending = 0;
+    }
+    streamLast = samples[records - 1].timestamp;
+    return records;
+}
+/** Stop collecting samples in the FIFO.
+ * @see startStream()
+ */
+void MPU6050::stopStream() {
+    streamRecord = 0;
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT>::write(devAddr, false);
+    I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_EN, 0);
+}
+/** Signal every new sample on the INT pin, so a streaming reader can sleep on
+ * an I2Cirq (e.g. an I2Cgpio on the line INT is wired to) instead of polling.
+ * INT is set up as an active-high push-pull output that gives one 50 us
+ * pulse per sample, so a rising-edge line sees each sample exactly once and
+ * I2Cirq::wait() can count them out in batches. Status bits still clear only
+ * when INT_STATUS is read, which readStream() needs to see overflows.
+ * @param enabled True to pulse INT on data ready, false to leave INT idle
+ * @see setInterruptLatch()
+ * @see setIntDataReadyEnabled()
+ * @see MPU6050_RA_INT_PIN_CFG
+ */
+void MPU6050::setStreamInterruptEnabled(bool enabled) {
+    if (enabled) {
+        setInterruptMode(false);        // active high
+        setInterruptDrive(false);       // push-pull
+        setInterruptLatch(false);       // 50 us pulse per sample
+        setInterruptLatchClear(false);  // status clears on INT_STATUS reads only
+    }
+    setIntDataReadyEnabled(enabled);
+}
+/** Empty the FIFO after it lost its framing and count what was lost.
+ * USER_CTRL is read once, then the FIFO is stopped, reset and restarted
+ * with a single transaction, which also reads away an overflow flag raised
+ * again before the reset.
+ * @param now Time the loss was found, CLOCK_MONOTONIC ns
+ * @return Status of operation (true = success)
+ */
+bool MPU6050::resyncStream(uint64_t now) {
+    uint8_t control, status;
+    uint32_t lost;
+
+    if (I2Cdev::readByte(devAddr, MPU6050_RA_USER_CTRL, &control) <= 0) return false;
+    I2Ctransaction transaction;
+    transaction.writeByte(devAddr, MPU6050_RA_USER_CTRL,
+        (control & ~(1 << MPU6050_USERCTRL_FIFO_EN_BIT)) | (1 << MPU6050_USERCTRL_FIFO_RESET_BIT));
+    transaction.writeByte(devAddr, MPU6050_RA_USER_CTRL, control | (1 << MPU6050_USERCTRL_FIFO_EN_BIT));
+    transaction.readByte(devAddr, MPU6050_RA_INT_STATUS, &status);
+    transaction.once();
+    if (!transaction.submit()) return false;
+    // everything taken since the last sample delivered was in the FIFO
+    lost = now > streamLast ? (now - streamLast + streamPeriod / 2) / streamPeriod : 0;
+    streamPending += lost;
+    streamLost += lost;
+    streamResyncs++;
+    streamLast = now;
+    return true;
+}
+
 // WHO_AM_I register
 
 /** Get Device ID.
@@ -2700,7 +2998,7 @@ void MPU6050::setFIFOByte(uint8_t data) {
  * @see MPU6050_WHO_AM_I_LENGTH
  */
 uint8_t MPU6050::getDeviceID() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 /** Set Device ID.
@@ -2713,7 +3011,7 @@ uint8_t MPU6050::getDeviceID() {
  * @see MPU6050_WHO_AM_I_LENGTH
  */
 void MPU6050::setDeviceID(uint8_t id) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id);
+    I2Cfield<MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH>::write(devAddr, id);
 }
 
 // ======== UNDOCUMENTED/DMP REGISTERS/METHODS ========
@@ -2721,38 +3019,38 @@ void MPU6050::setDeviceID(uint8_t id) {
 // XG_OFFS_TC register
 
 uint8_t MPU6050::getOTPBankValid() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT, buffer);
+    I2Cfield<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setOTPBankValid(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT, enabled);
+    I2Cfield<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT>::write(devAddr, enabled);
 }
 int8_t MPU6050::getXGyroOffset() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setXGyroOffset(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset);
+    I2Cfield<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset);
 }
 
 // YG_OFFS_TC register
 
 int8_t MPU6050::getYGyroOffset() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setYGyroOffset(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset);
+    I2Cfield<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset);
 }
 
 // ZG_OFFS_TC register
 
 int8_t MPU6050::getZGyroOffset() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer);
+    I2Cfield<MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setZGyroOffset(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset);
+    I2Cfield<MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset);
 }
 
 // X_FINE_GAIN register
@@ -2815,6 +3113,32 @@ void MPU6050::setZAccelOffset(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU6050_RA_ZA_OFFS_H, offset);
 }
 
+// XA_OFFS_* .. ZA_OFFS_* registers
+
+/** Get all three accelerometer offsets in one burst.
+ * @param x Container for X-axis offset
+ * @param y Container for Y-axis offset
+ * @param z Container for Z-axis offset
+ * @see getXAccelOffset()
+ */
+void MPU6050::getAccelOffset(int16_t* x, int16_t* y, int16_t* z) {
+    uint16_t offsets[3] = { 0, 0, 0 };
+    I2Cdev::readWords(devAddr, MPU6050_RA_XA_OFFS_H, 3, offsets);
+    *x = offsets[0];
+    *y = offsets[1];
+    *z = offsets[2];
+}
+/** Set all three accelerometer offsets in one burst.
+ * @param x New X-axis offset
+ * @param y New Y-axis offset
+ * @param z New Z-axis offset
+ * @see setXAccelOffset()
+ */
+void MPU6050::setAccelOffset(int16_t x, int16_t y, int16_t z) {
+    uint16_t offsets[3] = { (uint16_t)x, (uint16_t)y, (uint16_t)z };
+    I2Cdev::writeWords(devAddr, MPU6050_RA_XA_OFFS_H, 3, offsets);
+}
+
 // XG_OFFS_USR* registers
 
 int16_t MPU6050::getXGyroOffsetUser() {
@@ -2845,72 +3169,98 @@ void MPU6050::setZGyroOffsetUser(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU6050_RA_ZG_OFFS_USRH, offset);
 }
 
+// XG_OFFS_USR* .. ZG_OFFS_USR* registers
+
+/** Get all three user gyroscope offsets in one burst.
+ * @param x Container for X-axis offset
+ * @param y Container for Y-axis offset
+ * @param z Container for Z-axis offset
+ * @see getXGyroOffsetUser()
+ */
+void MPU6050::getGyroOffsetUser(int16_t* x, int16_t* y, int16_t* z) {
+    uint16_t offsets[3] = { 0, 0, 0 };
+    I2Cdev::readWords(devAddr, MPU6050_RA_XG_OFFS_USRH, 3, offsets);
+    *x = offsets[0];
+    *y = offsets[1];
+    *z = offsets[2];
+}
+/** Set all three user gyroscope offsets in one burst.
+ * @param x New X-axis offset
+ * @param y New Y-axis offset
+ * @param z New Z-axis offset
+ * @see setXGyroOffsetUser()
+ */
+void MPU6050::setGyroOffsetUser(int16_t x, int16_t y, int16_t z) {
+    uint16_t offsets[3] = { (uint16_t)x, (uint16_t)y, (uint16_t)z };
+    I2Cdev::writeWords(devAddr, MPU6050_RA_XG_OFFS_USRH, 3, offsets);
+}
+
 // INT_ENABLE register (DMP functions)
 
 bool MPU6050::getIntPLLReadyEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setIntPLLReadyEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT>::write(devAddr, enabled);
 }
 bool MPU6050::getIntDMPEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setIntDMPEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT, enabled);
+    I2Cfield<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT>::write(devAddr, enabled);
 }
 
 // DMP_INT_STATUS
 
 bool MPU6050::getDMPInt5Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_5_BIT, buffer);
+    I2Cfield<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_5_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt4Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_4_BIT, buffer);
+    I2Cfield<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_4_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt3Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_3_BIT, buffer);
+    I2Cfield<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_3_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt2Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_2_BIT, buffer);
+    I2Cfield<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_2_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt1Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_1_BIT, buffer);
+    I2Cfield<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_1_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt0Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_0_BIT, buffer);
+    I2Cfield<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_0_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
 // INT_STATUS register (DMP functions)
 
 bool MPU6050::getIntPLLReadyStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_PLL_RDY_INT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getIntDMPStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DMP_INT_BIT, buffer);
+    I2Cfield<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DMP_INT_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
 // USER_CTRL register (DMP functions)
 
 bool MPU6050::getDMPEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, buffer);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setDMPEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, enabled);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT>::write(devAddr, enabled);
 }
 void MPU6050::resetDMP() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT, true);
+    I2Cfield<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT>::write(devAddr, true);
 }
 
 // BANK_SEL register
@@ -2938,8 +3288,9 @@ void MPU6050::writeMemoryByte(uint8_t data) {
     I2Cdev::writeByte(devAddr, MPU6050_RA_MEM_R_W, data);
 }
 void MPU6050::readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address) {
-    setMemoryBank(bank);
-    setMemoryStartAddress(address);
+    // Every chunk is queued as bank select + start address + read, and the
+    // whole block is submitted as a few combined transactions.
+    I2Ctransaction transaction;
     uint8_t chunkSize;
     for (uint16_t i = 0; i < dataSize;) {
         // determine correct chunk size according to bank position and data size
@@ -2951,98 +3302,81 @@ void MPU6050::readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, ui
         // make sure this chunk doesn't go past the bank boundary (256 bytes)
         if (chunkSize > 256 - address) chunkSize = 256 - address;
 
-        // read the chunk of data as specified
-        I2Cdev::readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, data + i);
-        
+        // read the chunk of data as specified (bank byte as setMemoryBank(bank) writes it);
+        // a retry has to select the bank and address again before MEM_R_W
+        transaction.group();
+        transaction.writeByte(devAddr, MPU6050_RA_BANK_SEL, bank & 0x1F);
+        transaction.writeByte(devAddr, MPU6050_RA_MEM_START_ADDR, address);
+        transaction.readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, data + i);
+
         // increase byte index by [chunkSize]
         i += chunkSize;
 
         // uint8_t automatically wraps to 0 at 256
         address += chunkSize;
 
-        // if we aren't done, update bank (if necessary) and address
-        if (i < dataSize) {
-            if (address == 0) bank++;
-            setMemoryBank(bank);
-            setMemoryStartAddress(address);
-        }
+        // if we aren't done, update bank (if necessary)
+        if (i < dataSize && address == 0) bank++;
     }
+    transaction.submit();
 }
 bool MPU6050::writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify, bool useProgMem) {
-    setMemoryBank(bank);
-    setMemoryStartAddress(address);
+    // Each bank-bounded run is streamed from the caller's buffer as a single
+    // write to MEM_R_W (the memory address advances behind it), after one
+    // 2-byte write of BANK_SEL and MEM_START_ADDR. Verification reads are
+    // queued and submitted together at the end, as in readMemoryBlock().
+    // pgm_read_byte() is a plain dereference here, so useProgMem data needs
+    // no staging copy. All of it is bulk work: it goes out in small pieces
+    // and sensor reads from other threads get the bus in between.
+    (void)useProgMem;
+    I2Cpriority bulk(I2CBUS_PRIORITY_BULK);
+    I2Ctransaction transaction;
+    struct iovec segment;
+    uint8_t select[2];
+    uint16_t runSize, i, j;
     uint8_t chunkSize;
-    uint8_t *verifyBuffer;
-    uint8_t *progBuffer = NULL; // Keep compiler quiet
-    uint16_t i;
-    uint8_t j;
-    if (verify) verifyBuffer = (uint8_t *)malloc(MPU6050_DMP_MEMORY_CHUNK_SIZE);
-    if (useProgMem) progBuffer = (uint8_t *)malloc(MPU6050_DMP_MEMORY_CHUNK_SIZE);
+    uint8_t *verifyBuffer = NULL;
+    bool status = true;
+    if (verify) verifyBuffer = (uint8_t *)malloc(dataSize);
     for (i = 0; i < dataSize;) {
-        // determine correct chunk size according to bank position and data size
-        chunkSize = MPU6050_DMP_MEMORY_CHUNK_SIZE;
-
-        // make sure we don't go past the data size
-        if (i + chunkSize > dataSize) chunkSize = dataSize - i;
-
-        // make sure this chunk doesn't go past the bank boundary (256 bytes)
-        if (chunkSize > 256 - address) chunkSize = 256 - address;
-        
-        if (useProgMem) {
-            // write the chunk of data as specified
-            for (j = 0; j < chunkSize; j++) progBuffer[j] = pgm_read_byte(data + i + j);
-        } else {
-            // write the chunk of data as specified
-            progBuffer = (uint8_t *)data + i;
+        // the run ends at the data end or the bank boundary (256 bytes)
+        runSize = dataSize - i;
+        if (runSize > 256 - address) runSize = 256 - address;
+
+        // write the run as specified (bank byte as setMemoryBank(bank) writes it)
+        select[0] = bank & 0x1F;
+        select[1] = address;
+        segment.iov_base = (void *)(data + i);
+        segment.iov_len = runSize;
+        if (!I2Cdev::writeBytes(devAddr, MPU6050_RA_BANK_SEL, 2, select) ||
+            !I2Cdev::writeSegments(devAddr, MPU6050_RA_MEM_R_W, &segment, 1, false)) {
+            status = false;
+            break;
         }
 
-        I2Cdev::writeBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, progBuffer);
-
-        // verify data if needed
-        if (verify && verifyBuffer) {
-            setMemoryBank(bank);
-            setMemoryStartAddress(address);
-            I2Cdev::readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, verifyBuffer);
-            if (memcmp(progBuffer, verifyBuffer, chunkSize) != 0) {
-                /*Serial.print("Block write verification error, bank ");
-                Serial.print(bank, DEC);
-                Serial.print(", address ");
-                Serial.print(address, DEC);
-                Serial.print("!\nExpected:");
-                for (j = 0; j < chunkSize; j++) {
-                    Serial.print(" 0x");
-                    if (progBuffer[j] < 16) Serial.print("0");
-                    Serial.print(progBuffer[j], HEX);
-                }
-                Serial.print("\nReceived:");
-                for (uint8_t j = 0; j < chunkSize; j++) {
-                    Serial.print(" 0x");
-                    if (verifyBuffer[i + j] < 16) Serial.print("0");
-                    Serial.print(verifyBuffer[i + j], HEX);
-                }
-                Serial.print("\n");*/
-                free(verifyBuffer);
-                if (useProgMem) free(progBuffer);
-                return false; // uh oh.
-            }
+        // read it back for verification if needed
+        for (j = 0; verifyBuffer && j < runSize; j += chunkSize) {
+            chunkSize = runSize - j > MPU6050_DMP_MEMORY_CHUNK_SIZE ? MPU6050_DMP_MEMORY_CHUNK_SIZE : runSize - j;
+            transaction.group();
+            transaction.writeByte(devAddr, MPU6050_RA_BANK_SEL, bank & 0x1F);
+            transaction.writeByte(devAddr, MPU6050_RA_MEM_START_ADDR, address + j);
+            transaction.readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, verifyBuffer + i + j);
         }
 
-        // increase byte index by [chunkSize]
-        i += chunkSize;
+        // increase byte index by [runSize]
+        i += runSize;
 
         // uint8_t automatically wraps to 0 at 256
-        address += chunkSize;
+        address += runSize;
 
-        // if we aren't done, update bank (if necessary) and address
-        if (i < dataSize) {
-            if (address == 0) bank++;
-            setMemoryBank(bank);
-            setMemoryStartAddress(address);
-        }
+        // if we aren't done, update bank (if necessary)
+        if (i < dataSize && address == 0) bank++;
     }
-    if (verify) free(verifyBuffer);
-    if (useProgMem) free(progBuffer);
-    return true;
+    if (status && verifyBuffer) {
+        status = transaction.submit() && memcmp(data, verifyBuffer, dataSize) == 0;
+    }
+    free(verifyBuffer);
+    return status;
 }
 bool MPU6050::writeProgMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify) {
     return writeMemoryBlock(data, dataSize, bank, address, verify, true);
@@ -397,16 +397,49 @@ THE SOFTWARE.
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
 
+#define MPU6050_FIFO_SIZE               1024
+#define MPU6050_STREAM_RECORD           12  // accel x/y/z, gyro x/y/z
+#define MPU6050_STREAM_RECORD_TEMP      14  // accel x/y/z, temperature, gyro x/y/z
+
 // note: DMP code memory blocks defined at end of header file
 
+// One record of the FIFO stream, see MPU6050::startStream(). A non-zero lost
+// marks a discontinuity: that many samples were dropped right before this one
+// (FIFO overflow or lost framing), and sequence has skipped them.
+struct MPU6050sample {
+    int16_t ax, ay, az;
+    int16_t temperature;    // 0 unless the stream carries it
+    int16_t gx, gy, gz;
+    uint32_t lost;
+    uint32_t sequence;      // sample number since startStream(), lost ones included
+    uint64_t timestamp;     // CLOCK_MONOTONIC ns the sample was taken, estimated
+};
+
 class MPU6050 {
     public:
         MPU6050();
-        MPU6050(uint8_t address);
+        MPU6050(uint16_t address);
+        MPU6050(uint8_t address, uint8_t adapter);
 
         void initialize();
         bool testConnection();
 
+        // shadow register cache (see I2Ccache)
+        void setRegisterCacheEnabled(bool enabled);
+        bool resyncRegisterCache();
+        void setRegisterWriteBackEnabled(bool enabled);
+        bool flushRegisters();
+        void setReadCoalescingEnabled(bool enabled);
+
+        // FIFO streaming
+        bool startStream(uint8_t rate, bool temperature=false);
+        int readStream(MPU6050sample *samples, int count);
+        void stopStream();
+        void setStreamInterruptEnabled(bool enabled);
+        uint8_t getStreamRecordSize() const { return streamRecord; }
+        uint32_t getStreamLost() const { return streamLost; }
+        uint32_t getStreamResyncs() const { return streamResyncs; }
+
         // AUX_VDDIO register
         uint8_t getAuxVDDIOLevel();
         void setAuxVDDIOLevel(uint8_t level);
@@ -718,6 +751,10 @@ class MPU6050 {
         int16_t getZAccelOffset();
         void setZAccelOffset(int16_t offset);
 
+        // XA_OFFS_* .. ZA_OFFS_* registers
+        void getAccelOffset(int16_t* x, int16_t* y, int16_t* z);
+        void setAccelOffset(int16_t x, int16_t y, int16_t z);
+
         // XG_OFFS_USR* registers
         int16_t getXGyroOffsetUser();
         void setXGyroOffsetUser(int16_t offset);
@@ -729,6 +766,10 @@ class MPU6050 {
         // ZG_OFFS_USR* register
         int16_t getZGyroOffsetUser();
         void setZGyroOffsetUser(int16_t offset);
+
+        // XG_OFFS_USR* .. ZG_OFFS_USR* registers
+        void getGyroOffsetUser(int16_t* x, int16_t* y, int16_t* z);
+        void setGyroOffsetUser(int16_t x, int16_t y, int16_t z);
         
         // INT_ENABLE register (DMP functions)
         bool getIntPLLReadyEnabled();
@@ -981,8 +1022,17 @@ class MPU6050 {
         #endif
 
     private:
-        uint8_t devAddr;
+        uint16_t devAddr;
         uint8_t buffer[14];
+        uint8_t streamRecord;   // bytes per FIFO record while streaming, 0 if not
+        uint32_t streamPeriod;  // ns between samples
+        uint64_t streamLast;    // timestamp of the last sample delivered, or of the last FIFO reset
+        uint32_t streamSequence;
+        uint32_t streamPending; // lost samples not yet reported in a sample
+        uint32_t streamLost;
+        uint32_t streamResyncs;
+
+        bool resyncStream(uint64_t now);
 };
 
 #endif /* _MPU6050_H_ */
@@ -1,6 +1,6 @@
 /**********************************************************************
 * Filename    : MPU6050RAW.c
-* Description : Read data of MPU6050
+* Description : Read every sample of MPU6050 through its FIFO
 * Author      : www.freenove.com
 * modification: 2019/12/27
 **********************************************************************/
@@ -12,8 +12,9 @@
 
 MPU6050 accelgyro;      //creat MPU6050 class object
 
-int16_t ax, ay, az;     //store acceleration data
-int16_t gx, gy, gz;     //store gyroscope data
+#define SAMPLE_RATE_DIVIDER 9   //1 kHz / (1 + 9) = 100 samples per second
+
+MPU6050sample samples[MPU6050_FIFO_SIZE / MPU6050_STREAM_RECORD];  //room for a full FIFO
 
 void setup() {
     // initialize device
@@ -23,15 +24,28 @@ void setup() {
     // verify connection
     printf("Testing device connections...\n");
     printf(accelgyro.testConnection() ? "MPU6050 connection successful\n" : "MPU6050 connection failed\n");
+
+    // collect every sample in the FIFO instead of polling the data registers
+    accelgyro.setDLPFMode(MPU6050_DLPF_BW_42);
+    if (!accelgyro.startStream(SAMPLE_RATE_DIVIDER)) {
+        printf("MPU6050 FIFO could not be started\n");
+    }
 }
 
 void loop() {
-    // read accel/gyro values of MPU6050
-    accelgyro.getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
-    // display accel/gyro x/y/z values
-    printf("a/g: %6hd %6hd %6hd   %6hd %6hd %6hd\n",ax,ay,az,gx,gy,gz);
-    printf("a/g: %.2f g %.2f g %.2f g   %.2f d/s %.2f d/s %.2f d/s \n",(float)ax/16384,(float)ay/16384,(float)az/16384,
-        (float)gx/131,(float)gy/131,(float)gz/131);
+    // let a few samples collect, then fetch all of them in one burst
+    usleep(20000);
+    int count = accelgyro.readStream(samples, sizeof(samples) / sizeof(samples[0]));
+    for (int i = 0; i < count; i++) {
+        const MPU6050sample &s = samples[i];
+        if (s.lost > 0) {
+            printf("--- %u samples lost ---\n", s.lost);  //the FIFO overflowed, the stream restarted
+        }
+        // display accel/gyro x/y/z values
+        printf("a/g: %6hd %6hd %6hd   %6hd %6hd %6hd\n",s.ax,s.ay,s.az,s.gx,s.gy,s.gz);
+        printf("a/g: %.2f g %.2f g %.2f g   %.2f d/s %.2f d/s %.2f d/s \n",(float)s.ax/16384,(float)s.ay/16384,(float)s.az/16384,
+            (float)s.gx/131,(float)s.gy/131,(float)s.gz/131);
+    }
 }
 
 int main()
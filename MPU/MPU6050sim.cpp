@@ -0,0 +1,214 @@
+// I2Cdev library collection - MPU6050 register model for I2Csim
+// Register-level stand-in for an MPU6050 on the simulated bus: power-on
+// register values, self-clearing reset bits, a fresh motion sample for every
+// burst read of the data registers, the DMP memory port, and a FIFO that
+// takes the enabled sensor registers at the sample rate in wall-clock time.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "MPU6050sim.h"
+#include "MPU6050.h"
+#include "I2Cbus.h"
+
+MPU6050sim::MPU6050sim() : sample(0) {
+    reset();
+}
+
+/** Return every register and the DMP memory to power-on state.
+ */
+void MPU6050sim::reset() {
+    memset(regs, 0, sizeof(regs));
+    memset(dmp, 0, sizeof(dmp));
+    memset(fifo, 0, sizeof(fifo));
+    regs[MPU6050_RA_PWR_MGMT_1] = 0x40;     // SLEEP
+    regs[MPU6050_RA_WHO_AM_I] = MPU6050_ADDRESS_AD0_LOW;
+    pointer = 0;
+    fifoHead = 0;
+    fifoLength = 0;
+    fifoClock = 0;
+}
+
+/** Every read first puts the samples taken since the last one into the
+ * FIFO. One that starts inside the sensor data registers then sees a new
+ * sample, the way the real part latches its output registers per burst.
+ */
+int MPU6050sim::read(uint8_t *buf, uint16_t length) {
+    fillFIFO();
+    if (pointer >= MPU6050_RA_ACCEL_XOUT_H && pointer <= MPU6050_RA_GYRO_ZOUT_L) {
+        latchSample();
+    }
+    return I2Cregisters::read(buf, length);
+}
+
+uint8_t MPU6050sim::readRegister(uint8_t reg) {
+    switch (reg) {
+        case MPU6050_RA_MEM_R_W:
+            return *memoryCell();
+        case MPU6050_RA_FIFO_COUNTH:
+            return fifoLength >> 8;
+        case MPU6050_RA_FIFO_COUNTL:
+            return fifoLength & 0xFF;
+        case MPU6050_RA_FIFO_R_W:
+            return popFIFO();
+        case MPU6050_RA_INT_STATUS: {
+            // interrupt status bits clear when read
+            uint8_t status = regs[reg];
+            regs[reg] = 0;
+            return status;
+        }
+    }
+    return regs[reg];
+}
+
+void MPU6050sim::writeRegister(uint8_t reg, uint8_t value) {
+    switch (reg) {
+        case MPU6050_RA_PWR_MGMT_1:
+            if (value & (1 << MPU6050_PWR1_DEVICE_RESET_BIT)) {
+                reset();
+                return;
+            }
+            break;
+        case MPU6050_RA_USER_CTRL:
+            if (value & (1 << MPU6050_USERCTRL_FIFO_RESET_BIT)) {
+                fifoHead = 0;
+                fifoLength = 0;
+            }
+            if ((value & (1 << MPU6050_USERCTRL_FIFO_EN_BIT)) && !(regs[reg] & (1 << MPU6050_USERCTRL_FIFO_EN_BIT))) {
+                fifoClock = monotonicNs();
+            }
+            // FIFO, I2C master, signal path and DMP resets clear themselves
+            value &= ~((1 << MPU6050_USERCTRL_DMP_RESET_BIT) | (1 << MPU6050_USERCTRL_FIFO_RESET_BIT) |
+                (1 << MPU6050_USERCTRL_I2C_MST_RESET_BIT) | (1 << MPU6050_USERCTRL_SIG_COND_RESET_BIT));
+            break;
+        case MPU6050_RA_MEM_R_W:
+            *memoryCell() = value;
+            return;
+        case MPU6050_RA_FIFO_R_W:
+            pushFIFO(value);
+            return;
+        case MPU6050_RA_FIFO_COUNTH:
+        case MPU6050_RA_FIFO_COUNTL:
+        case MPU6050_RA_INT_STATUS:
+        case MPU6050_RA_WHO_AM_I:
+            return;
+    }
+    regs[reg] = value;
+}
+
+bool MPU6050sim::autoIncrement(uint8_t reg) {
+    return reg != MPU6050_RA_MEM_R_W && reg != MPU6050_RA_FIFO_R_W;
+}
+
+// Deterministic ramps, so runs are reproducible and values easy to check.
+void MPU6050sim::latchSample() {
+    int16_t values[7];
+
+    sample++;
+    values[0] = (int16_t)(sample * 3);      // accel x
+    values[1] = (int16_t)(sample * -5);     // accel y
+    values[2] = 16384;                      // accel z, 1 g at +-2 g
+    values[3] = -521;                       // temperature, about 35 C
+    values[4] = (int16_t)(sample * 7);      // gyro x
+    values[5] = (int16_t)(sample * -11);    // gyro y
+    values[6] = 0;                          // gyro z
+    for (int i = 0; i < 7; i++) {
+        regs[MPU6050_RA_ACCEL_XOUT_H + i * 2] = (uint16_t)values[i] >> 8;
+        regs[MPU6050_RA_ACCEL_XOUT_H + i * 2 + 1] = (uint16_t)values[i] & 0xFF;
+    }
+}
+
+// The DMP memory port reads or writes at BANK_SEL:MEM_START_ADDR and then
+// advances the start address.
+uint8_t *MPU6050sim::memoryCell() {
+    uint8_t *cell = &dmp[regs[MPU6050_RA_BANK_SEL] % MPU6050SIM_MEMORY_BANKS][regs[MPU6050_RA_MEM_START_ADDR]];
+    if (++regs[MPU6050_RA_MEM_START_ADDR] == 0) regs[MPU6050_RA_BANK_SEL]++;
+    return cell;
+}
+
+// Take the samples due since the last call into the FIFO: the registers
+// enabled in FIFO_EN, in register order, once per 1 kHz / (1 + SMPLRT_DIV)
+// (8 kHz with the DLPF off) while USER_CTRL.FIFO_EN is set and the part is
+// awake.
+void MPU6050sim::fillFIFO() {
+    static const struct { uint8_t bit, reg, length; } sources[] = {
+        { MPU6050_ACCEL_FIFO_EN_BIT, MPU6050_RA_ACCEL_XOUT_H, 6 },
+        { MPU6050_TEMP_FIFO_EN_BIT, MPU6050_RA_TEMP_OUT_H, 2 },
+        { MPU6050_XG_FIFO_EN_BIT, MPU6050_RA_GYRO_XOUT_H, 2 },
+        { MPU6050_YG_FIFO_EN_BIT, MPU6050_RA_GYRO_YOUT_H, 2 },
+        { MPU6050_ZG_FIFO_EN_BIT, MPU6050_RA_GYRO_ZOUT_H, 2 },
+    };
+    uint8_t dlpf = regs[MPU6050_RA_CONFIG] & 0x07;
+    uint64_t period = (dlpf == 0 || dlpf == 7 ? 125000ull : 1000000ull) * (1 + regs[MPU6050_RA_SMPLRT_DIV]);
+    uint64_t now = monotonicNs(), due;
+
+    if (!(regs[MPU6050_RA_USER_CTRL] & (1 << MPU6050_USERCTRL_FIFO_EN_BIT)) ||
+        (regs[MPU6050_RA_PWR_MGMT_1] & (1 << MPU6050_PWR1_SLEEP_BIT)) || regs[MPU6050_RA_FIFO_EN] == 0) {
+        fifoClock = now;
+        return;
+    }
+    due = (now - fifoClock) / period;
+    // only the last FIFO-full of a long gap can still be in the FIFO
+    if (due > MPU6050SIM_FIFO_SIZE) {
+        sample += due - MPU6050SIM_FIFO_SIZE;
+        fifoClock += (due - MPU6050SIM_FIFO_SIZE) * period;
+        due = MPU6050SIM_FIFO_SIZE;
+    }
+    for (; due > 0; due--) {
+        fifoClock += period;
+        latchSample();
+        regs[MPU6050_RA_INT_STATUS] |= 1 << MPU6050_INTERRUPT_DATA_RDY_BIT;
+        for (unsigned i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+            if (!(regs[MPU6050_RA_FIFO_EN] & (1 << sources[i].bit))) continue;
+            for (uint8_t j = 0; j < sources[i].length; j++) pushFIFO(regs[sources[i].reg + j]);
+        }
+    }
+}
+
+// A full FIFO drops its oldest byte and raises FIFO_OFLOW_INT, like the
+// real one, so records read after an overflow are out of phase.
+void MPU6050sim::pushFIFO(uint8_t value) {
+    if (fifoLength == MPU6050SIM_FIFO_SIZE) {
+        fifoHead = (fifoHead + 1) % MPU6050SIM_FIFO_SIZE;
+        fifoLength--;
+        regs[MPU6050_RA_INT_STATUS] |= 1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT;
+    }
+    fifo[(fifoHead + fifoLength) % MPU6050SIM_FIFO_SIZE] = value;
+    fifoLength++;
+}
+
+// An empty FIFO repeats the last byte read.
+uint8_t MPU6050sim::popFIFO() {
+    if (fifoLength == 0) return fifo[(fifoHead + MPU6050SIM_FIFO_SIZE - 1) % MPU6050SIM_FIFO_SIZE];
+    uint8_t value = fifo[fifoHead];
+    fifoHead = (fifoHead + 1) % MPU6050SIM_FIFO_SIZE;
+    fifoLength--;
+    return value;
+}
@@ -0,0 +1,74 @@
+// I2Cdev library collection - MPU6050 register model for I2Csim
+// Register-level stand-in for an MPU6050 on the simulated bus: power-on
+// register values, self-clearing reset bits, a fresh motion sample for every
+// burst read of the data registers, the DMP memory port, and a FIFO that
+// takes the enabled sensor registers at the sample rate in wall-clock time.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050SIM_H_
+#define _MPU6050SIM_H_
+
+#include <stdint.h>
+#include "I2Csim.h"
+
+#define MPU6050SIM_MEMORY_BANKS 8
+#define MPU6050SIM_FIFO_SIZE    1024
+
+class MPU6050sim : public I2Cregisters {
+    public:
+        MPU6050sim();
+
+        int read(uint8_t *buf, uint16_t length);
+
+        void reset();
+        uint32_t samples() const { return sample; }
+        uint16_t fifoCount() const { return fifoLength; }
+        uint8_t memory(uint8_t bank, uint8_t address) const { return dmp[bank % MPU6050SIM_MEMORY_BANKS][address]; }
+
+    protected:
+        uint8_t readRegister(uint8_t reg);
+        void writeRegister(uint8_t reg, uint8_t value);
+        bool autoIncrement(uint8_t reg);
+
+    private:
+        void latchSample();
+        uint8_t *memoryCell();
+        void fillFIFO();
+        void pushFIFO(uint8_t value);
+        uint8_t popFIFO();
+
+        uint32_t sample;
+        uint8_t dmp[MPU6050SIM_MEMORY_BANKS][256];
+        uint8_t fifo[MPU6050SIM_FIFO_SIZE];
+        uint16_t fifoHead;      // oldest byte
+        uint16_t fifoLength;
+        uint64_t fifoClock;     // CLOCK_MONOTONIC ns of the last sample taken
+};
+
+#endif /* _MPU6050SIM_H_ */
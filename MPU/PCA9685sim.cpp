@@ -0,0 +1,107 @@
+// I2Cdev library collection - PCA9685 register model for I2Csim
+// Register-level stand-in for a PCA9685 PWM controller on the simulated bus:
+// power-on register values, MODE1 auto-increment, ALL_LED fan-out and the
+// sleep-only PRE_SCALE register.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "PCA9685sim.h"
+
+#define LED_LAST    (PCA9685SIM_RA_LED0_ON_L + PCA9685SIM_CHANNELS * 4 - 1)
+
+PCA9685sim::PCA9685sim() : ledWrites(0) {
+    reset();
+}
+
+/** Return every register to its power-on value (datasheet section 7.3).
+ */
+void PCA9685sim::reset() {
+    memset(regs, 0, sizeof(regs));
+    regs[PCA9685SIM_RA_MODE1] = PCA9685SIM_MODE1_SLEEP | 0x01;  // ALLCALL
+    regs[PCA9685SIM_RA_MODE2] = 0x04;                           // OUTDRV
+    regs[PCA9685SIM_RA_SUBADR1] = 0xE2;
+    regs[PCA9685SIM_RA_SUBADR2] = 0xE4;
+    regs[PCA9685SIM_RA_SUBADR3] = 0xE8;
+    regs[PCA9685SIM_RA_ALLCALLADR] = 0xE0;
+    for (int ch = 0; ch < PCA9685SIM_CHANNELS; ch++) {
+        regs[PCA9685SIM_RA_LED0_ON_L + ch * 4 + 3] = 0x10;      // full off
+    }
+    regs[PCA9685SIM_RA_PRE_SCALE] = 0x1E;                       // 200 Hz
+    pointer = 0;
+}
+
+/** Get the 13-bit ON register pair of a channel (bit 12 = full on).
+ * @param channel Channel 0-15
+ */
+uint16_t PCA9685sim::on(uint8_t channel) const {
+    uint8_t reg = PCA9685SIM_RA_LED0_ON_L + (channel % PCA9685SIM_CHANNELS) * 4;
+    return regs[reg] | (regs[reg + 1] << 8);
+}
+
+/** Get the 13-bit OFF register pair of a channel (bit 12 = full off).
+ * @param channel Channel 0-15
+ */
+uint16_t PCA9685sim::off(uint8_t channel) const {
+    uint8_t reg = PCA9685SIM_RA_LED0_ON_L + (channel % PCA9685SIM_CHANNELS) * 4 + 2;
+    return regs[reg] | (regs[reg + 1] << 8);
+}
+
+uint8_t PCA9685sim::readRegister(uint8_t reg) {
+    // ALL_LED registers are write-only, reserved ones read as 0
+    if (reg >= PCA9685SIM_RA_ALL_LED_ON_L && reg <= PCA9685SIM_RA_ALL_LED_OFF_H) return 0;
+    if (reg > LED_LAST && reg < PCA9685SIM_RA_ALL_LED_ON_L) return 0;
+    return regs[reg];
+}
+
+void PCA9685sim::writeRegister(uint8_t reg, uint8_t value) {
+    if (reg >= PCA9685SIM_RA_LED0_ON_L && reg <= LED_LAST) {
+        ledWrites++;
+    } else if (reg >= PCA9685SIM_RA_ALL_LED_ON_L && reg <= PCA9685SIM_RA_ALL_LED_OFF_H) {
+        for (int ch = 0; ch < PCA9685SIM_CHANNELS; ch++) {
+            regs[PCA9685SIM_RA_LED0_ON_L + ch * 4 + (reg - PCA9685SIM_RA_ALL_LED_ON_L)] = value;
+        }
+        ledWrites++;
+        return;
+    } else if (reg == PCA9685SIM_RA_PRE_SCALE) {
+        // only writable while the oscillator is off
+        if (!(regs[PCA9685SIM_RA_MODE1] & PCA9685SIM_MODE1_SLEEP)) return;
+    } else if (reg == PCA9685SIM_RA_MODE1) {
+        // writing 1 to RESTART clears it
+        if (value & PCA9685SIM_MODE1_RESTART) value &= ~PCA9685SIM_MODE1_RESTART;
+    } else if (reg > LED_LAST) {
+        return;     // reserved
+    }
+    regs[reg] = value;
+}
+
+bool PCA9685sim::autoIncrement(uint8_t reg) {
+    (void)reg;
+    return regs[PCA9685SIM_RA_MODE1] & PCA9685SIM_MODE1_AI;
+}
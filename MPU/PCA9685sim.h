@@ -0,0 +1,76 @@
+// I2Cdev library collection - PCA9685 register model for I2Csim
+// Register-level stand-in for a PCA9685 PWM controller on the simulated bus:
+// power-on register values, MODE1 auto-increment, ALL_LED fan-out and the
+// sleep-only PRE_SCALE register.
+//
+// Changelog:
+//     2026-10-17 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _PCA9685SIM_H_
+#define _PCA9685SIM_H_
+
+#include <stdint.h>
+#include "I2Csim.h"
+
+#define PCA9685SIM_DEFAULT_ADDRESS  0x40
+
+#define PCA9685SIM_RA_MODE1         0x00
+#define PCA9685SIM_RA_MODE2         0x01
+#define PCA9685SIM_RA_SUBADR1       0x02
+#define PCA9685SIM_RA_SUBADR2       0x03
+#define PCA9685SIM_RA_SUBADR3       0x04
+#define PCA9685SIM_RA_ALLCALLADR    0x05
+#define PCA9685SIM_RA_LED0_ON_L     0x06
+#define PCA9685SIM_RA_ALL_LED_ON_L  0xFA
+#define PCA9685SIM_RA_ALL_LED_OFF_H 0xFD
+#define PCA9685SIM_RA_PRE_SCALE     0xFE
+
+#define PCA9685SIM_MODE1_SLEEP      0x10
+#define PCA9685SIM_MODE1_AI         0x20
+#define PCA9685SIM_MODE1_RESTART    0x80
+
+#define PCA9685SIM_CHANNELS         16
+
+class PCA9685sim : public I2Cregisters {
+    public:
+        PCA9685sim();
+
+        void reset();
+        uint16_t on(uint8_t channel) const;
+        uint16_t off(uint8_t channel) const;
+        uint32_t writes() const { return ledWrites; }
+
+    protected:
+        uint8_t readRegister(uint8_t reg);
+        void writeRegister(uint8_t reg, uint8_t value);
+        bool autoIncrement(uint8_t reg);
+
+    private:
+        uint32_t ledWrites;
+};
+
+#endif /* _PCA9685SIM_H_ */
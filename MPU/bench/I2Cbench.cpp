@@ -0,0 +1,923 @@
+/**********************************************************************
+* Filename    : I2Cbench.cpp
+* Description : Measure per-transaction cost of I2Cdev register reads
+*               against the old open/ioctl/transfer/close sequence and
+*               against separate write()+read() on a cached descriptor;
+*               "i2cbench sim" runs MPU6050 and PCA9685 workloads against
+*               register models on the simulated bus instead, and
+*               "i2cbench replay" reruns them from a captured trace,
+*               "i2cbench scan" times bus discovery against validating a
+*               topology cache, and "i2cbench stream" checks that FIFO
+*               streaming at 1 kHz gets every sample and accounts for the
+*               ones lost to an overflow, "i2cbench irq" compares the
+*               reader's CPU time polling the FIFO and sleeping on INT,
+*               "i2cbench ring" times handing samples to a consumer
+*               thread with each I2Cring wait policy, "i2cbench
+*               writeback" checks that buffered register writes made from
+*               several threads at once all reach the device, "i2cbench
+*               engine" checks that I2Cengine requests from several threads
+*               all complete, in order per thread, "i2cbench sched" runs
+*               many I2Cscheduler tasks on one thread and checks their
+*               transfers and overlapping delays, and "i2cbench retry"
+*               makes a simulated device NACK to check retries, backoff and
+*               the circuit breaker
+**********************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <atomic>
+#include <thread>
+#include <sys/ioctl.h>
+#include <linux/i2c-dev.h>
+#include "I2Cdev.h"
+#include "I2Cbus.h"
+#include "I2Cstats.h"
+#include "MPU6050.h"
+#include "I2Csim.h"
+#include "MPU6050sim.h"
+#include "PCA9685sim.h"
+#include "I2Ctrace.h"
+#include "I2Cerrors.h"
+#include "I2Ccoalesce.h"
+#include "I2Cscan.h"
+#include "I2Cpipe.h"
+#include "I2Cring.h"
+#include "I2Ccache.h"
+#include "I2Cengine.h"
+#include "I2Cscheduler.h"
+#include "I2Cretry.h"
+
+// What every I2Cdev::readBytes() used to do before the bus handle cache.
+static int8_t uncachedRead(uint8_t adapter, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    char path[20];
+    int8_t count;
+
+    snprintf(path, sizeof(path), "/dev/i2c-%u", adapter);
+    int fd = open(path, O_RDWR);
+    if (fd < 0) return -1;
+    if (ioctl(fd, I2C_SLAVE, devAddr) < 0 || write(fd, &regAddr, 1) != 1) {
+        close(fd);
+        return -1;
+    }
+    count = read(fd, data, length);
+    close(fd);
+    return count;
+}
+
+// Cached descriptor, but register write and data read as separate syscalls.
+static int8_t splitRead(uint8_t adapter, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    I2Cbus *bus = I2Cbus::get(adapter);
+
+    if (bus == NULL || bus->select(devAddr) < 0) return -1;
+    if (bus->write(&regAddr, 1) != 1) return -1;
+    return bus->read(data, length);
+}
+
+static void report(const char *name, uint64_t elapsed, int iterations, int failures) {
+    printf("%-10s %8d reads  %10.1f us/read  %d failed\n", name, iterations,
+        (double)elapsed / iterations / 1000.0, failures);
+}
+
+// MPU6050 motion reads and 16-channel PCA9685 updates through the drivers,
+// on whatever transport adapter 1 currently has.
+static int driverWorkload(int iterations) {
+    MPU6050 mpu;
+    int16_t ax, ay, az, gx, gy, gz;
+    uint8_t leds[PCA9685SIM_CHANNELS * 4];
+    uint64_t start, errors;
+    int failures, i, ch;
+
+    mpu.initialize();
+    if (!mpu.testConnection()) {
+        fprintf(stderr, "MPU6050 did not answer\n");
+        return 1;
+    }
+
+    errors = I2Cerrors::total(MPU6050_DEFAULT_ADDRESS);
+    start = monotonicNs();
+    for (i = 0; i < iterations; i++) {
+        mpu.getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
+    }
+    report("getMotion6", monotonicNs() - start, iterations, I2Cerrors::total(MPU6050_DEFAULT_ADDRESS) - errors);
+
+    // per-axis getters, separately and then coalesced per loop pass
+    for (int coalesced = 0; coalesced < 2; coalesced++) {
+        mpu.setReadCoalescingEnabled(coalesced);
+        errors = I2Cerrors::total(MPU6050_DEFAULT_ADDRESS);
+        start = monotonicNs();
+        for (i = 0; i < iterations; i++) {
+            I2Ccoalesce::tick();
+            ax = mpu.getAccelerationX();
+            ay = mpu.getAccelerationY();
+            az = mpu.getAccelerationZ();
+            gx = mpu.getTemperature();
+            gx = mpu.getRotationX();
+            gy = mpu.getRotationY();
+            gz = mpu.getRotationZ();
+        }
+        report(coalesced ? "coalesced" : "per-axis", monotonicNs() - start, iterations,
+            I2Cerrors::total(MPU6050_DEFAULT_ADDRESS) - errors);
+    }
+    mpu.setReadCoalescingEnabled(false);
+
+    // wake with register auto-increment, then rewrite all 16 channels per burst
+    I2Cdev::writeByte(PCA9685SIM_DEFAULT_ADDRESS, PCA9685SIM_RA_MODE1, PCA9685SIM_MODE1_AI);
+    failures = 0;
+    start = monotonicNs();
+    for (i = 0; i < iterations; i++) {
+        for (ch = 0; ch < PCA9685SIM_CHANNELS; ch++) {
+            uint16_t off = (i + ch * 256) & 0x0FFF;
+            leds[ch * 4] = 0;
+            leds[ch * 4 + 1] = 0;
+            leds[ch * 4 + 2] = off & 0xFF;
+            leds[ch * 4 + 3] = off >> 8;
+        }
+        if (!I2Cdev::writeBytes(PCA9685SIM_DEFAULT_ADDRESS, PCA9685SIM_RA_LED0_ON_L, sizeof(leds), leds)) failures++;
+    }
+    printf("%-10s %8d writes %10.1f us/write %d failed\n", "pca9685", iterations,
+        (double)(monotonicNs() - start) / iterations / 1000.0, failures);
+    return 0;
+}
+
+// Driver throughput on the simulated 400 kHz bus, reproducible on any machine;
+// optionally captured to a trace for "i2cbench replay".
+static int simBench(int iterations, const char *tracePath) {
+    I2Csim sim;
+    I2Ctrace trace(&sim, tracePath);
+    MPU6050sim mpuModel;
+    PCA9685sim pwmModel;
+    int result;
+
+    sim.attach(MPU6050_DEFAULT_ADDRESS, &mpuModel);
+    sim.attach(PCA9685SIM_DEFAULT_ADDRESS, &pwmModel);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, tracePath != NULL ? (I2Ctransport *)&trace : &sim);
+
+    printf("simulated bus, %d iterations\n", iterations);
+    result = driverWorkload(iterations);
+    printf("bus time   %10.1f ms, %u samples latched, %u LED register writes\n",
+        sim.busyNs() / 1e6, mpuModel.samples(), pwmModel.writes());
+    I2Cstats::dump(stdout);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    if (tracePath != NULL) {
+        printf("%u records traced to %s, %u dropped\n", trace.records(), tracePath, trace.dropped());
+    }
+    return result;
+}
+
+// The same workload answered from a captured trace.
+static int replayBench(int iterations, const char *tracePath) {
+    I2Creplay replay(tracePath);
+    int result;
+
+    replay.setLoop(true);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &replay);
+    if (I2Cbus::get(I2CBUS_DEFAULT_ADAPTER) == NULL) {
+        fprintf(stderr, "cannot load %s: %s\n", tracePath, strerror(errno));
+        return 1;
+    }
+
+    printf("replaying %s, %d iterations\n", tracePath, iterations);
+    result = driverWorkload(iterations);
+    printf("%u messages matched, %u missed, %u diverged\n", replay.matched(), replay.missed(), replay.diverged());
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    return result;
+}
+
+// Full scan of two simulated adapters against validating the cache it wrote.
+static int scanBench(const char *cachePath) {
+    static const uint8_t adapters[] = { I2CBUS_DEFAULT_ADAPTER, 3 };
+    I2Csim imuBus, servoBus;
+    MPU6050sim mpuModel;
+    PCA9685sim pwmModel;
+    std::vector<I2Cscan::Device> devices;
+    uint64_t start, scanned, validated;
+    int found;
+
+    imuBus.attach(MPU6050_DEFAULT_ADDRESS, &mpuModel);
+    servoBus.attach(PCA9685SIM_DEFAULT_ADDRESS, &pwmModel);
+    I2Cbus::setTransport(adapters[0], &imuBus);
+    I2Cbus::setTransport(adapters[1], &servoBus);
+
+    remove(cachePath);
+    start = monotonicNs();
+    found = I2Cscan::discover(cachePath, adapters, 2, devices);
+    scanned = monotonicNs() - start;
+    for (size_t i = 0; i < devices.size(); i++) {
+        printf("/dev/i2c-%u 0x%02x %s\n", I2CBUS_ADAPTER(devices[i].devAddr), I2CBUS_SLAVE(devices[i].devAddr),
+            devices[i].part);
+    }
+    start = monotonicNs();
+    bool cached = I2Cscan::load(cachePath, adapters, 2, devices) && I2Cscan::validate(devices);
+    validated = monotonicNs() - start;
+    printf("scan       %10.1f ms, %d devices, cache %s\n", scanned / 1e6, found, cachePath);
+    printf("validate   %10.1f ms, cache %s\n", validated / 1e6, cached ? "valid" : "stale");
+
+    I2Cbus::setTransport(adapters[0], NULL);
+    I2Cbus::setTransport(adapters[1], NULL);
+    return found == 2 && cached ? 0 : 1;
+}
+
+// 1 kHz FIFO stream from the simulated MPU6050, drained every few ms, with
+// one 150 ms stall halfway that overflows the FIFO. The model's accel x ramps
+// by 3 per sample, so the samples really skipped can be checked against the
+// ones the stream reports lost.
+static int streamBench(int ms) {
+    I2Csim sim;
+    MPU6050sim mpuModel;
+    MPU6050 mpu;
+    MPU6050sample samples[MPU6050_FIFO_SIZE / MPU6050_STREAM_RECORD];
+    uint64_t start, elapsed;
+    int drains = 0, received = 0, unreported = 0, skipped = 0, count = 0;
+    bool stalled = false;
+    int16_t last = 0;
+
+    sim.attach(MPU6050_DEFAULT_ADDRESS, &mpuModel);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &sim);
+    mpu.initialize();
+    mpu.setDLPFMode(MPU6050_DLPF_BW_188);
+    if (!mpu.startStream(0)) {
+        fprintf(stderr, "cannot start the FIFO stream\n");
+        I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+        return 1;
+    }
+
+    start = monotonicNs();
+    while ((elapsed = monotonicNs() - start) < (uint64_t)ms * 1000000) {
+        if (!stalled && elapsed >= (uint64_t)ms * 500000) {
+            usleep(150000);
+            stalled = true;
+        }
+        usleep(5000);
+        if ((count = mpu.readStream(samples, sizeof(samples) / sizeof(samples[0]))) < 0) break;
+        drains++;
+        for (int i = 0; i < count; i++, received++) {
+            int step = (int16_t)(samples[i].ax - last) / 3;
+            if (received > 0 && step != 1) {
+                skipped += step - 1;
+                if (samples[i].lost == 0) unreported++;
+            }
+            last = samples[i].ax;
+        }
+    }
+    mpu.stopStream();
+    printf("stream     %8d samples in %d ms, %d drains, %.2f transactions/ms\n",
+        received, ms, drains, drains * 2.0 / ms);
+    printf("lost       %8u reported in %u resyncs, %d skipped, %d gaps unreported\n",
+        mpu.getStreamLost(), mpu.getStreamResyncs(), skipped, unreported);
+    printf("bus time   %10.1f ms\n", sim.busyNs() / 1e6);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    // the count of a loss comes from the sample clock, so allow one either way
+    return count < 0 || unreported > 0 || abs(skipped - (int)mpu.getStreamLost()) > (int)mpu.getStreamResyncs() ? 1 : 0;
+}
+
+static uint64_t threadCpuNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Reader CPU time for a 1 kHz stream, busy-polling the FIFO against sleeping
+// until ten data-ready edges have come in. An I2Cpipe ticked at the sample
+// rate stands in for the INT line; the bus time is only counted, not spun,
+// so the CPU time is the reader's own.
+static int irqBench(int ms) {
+    I2Csim sim;
+    MPU6050sim mpuModel;
+    MPU6050 mpu;
+    I2Cpipe irq;
+    MPU6050sample samples[MPU6050_FIFO_SIZE / MPU6050_STREAM_RECORD];
+    int result = 0;
+
+    sim.setRealTime(false);
+    sim.attach(MPU6050_DEFAULT_ADDRESS, &mpuModel);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &sim);
+    mpu.initialize();
+    mpu.setDLPFMode(MPU6050_DLPF_BW_188);
+    mpu.setStreamInterruptEnabled(true);
+    if (irq.open() < 0) {
+        fprintf(stderr, "cannot create the interrupt pipe: %s\n", strerror(errno));
+        I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+        return 1;
+    }
+
+    for (int sleeping = 0; sleeping < 2 && result == 0; sleeping++) {
+        std::atomic<bool> running(true);
+        uint64_t start, cpu;
+        int received = 0, reads = 0, count;
+
+        if (!mpu.startStream(0)) {
+            fprintf(stderr, "cannot start the FIFO stream\n");
+            result = 1;
+            break;
+        }
+        std::thread pin([&]() {
+            struct timespec next;
+            clock_gettime(CLOCK_MONOTONIC, &next);
+            // edges only while something waits for them
+            while (sleeping && running.load(std::memory_order_relaxed)) {
+                if ((next.tv_nsec += 1000000) >= 1000000000) {
+                    next.tv_nsec -= 1000000000;
+                    next.tv_sec++;
+                }
+                clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+                irq.trigger();
+            }
+        });
+        cpu = threadCpuNs();
+        start = monotonicNs();
+        while (monotonicNs() - start < (uint64_t)ms * 1000000) {
+            if (sleeping && irq.wait(10, 100) < 0) {
+                result = 1;
+                break;
+            }
+            if ((count = mpu.readStream(samples, sizeof(samples) / sizeof(samples[0]))) < 0) {
+                result = 1;
+                break;
+            }
+            received += count;
+            reads++;
+        }
+        cpu = threadCpuNs() - cpu;
+        running = false;
+        pin.join();
+        mpu.stopStream();
+        printf("%-10s %8d samples in %d ms, %8d drains, %5.1f%% cpu, %u lost\n", sleeping ? "interrupt" : "polling",
+            received, ms, reads, cpu * 100.0 / ((uint64_t)ms * 1000000), mpu.getStreamLost());
+    }
+    mpu.setStreamInterruptEnabled(false);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    return result;
+}
+
+// The ring's own cost per record, batches of 16 written and read back on one
+// thread; then a producer thread hands records over in batches of 16 as fast
+// as the ring takes them, and the consumer takes up to 64 at a time and checks
+// their order. With fewer cores than threads the second figure is mostly
+// context switches.
+template <typename Wait>
+static int ringBench(const char *name, uint32_t records) {
+    static I2Cring<MPU6050sample, 1024, Wait> ring;
+    MPU6050sample batch[64];
+    uint32_t expected = 0, disordered = 0;
+    uint64_t start, elapsed;
+
+    memset(batch, 0, sizeof(batch));
+    start = monotonicNs();
+    for (uint32_t i = 0; i < records; i += 16) {
+        ring.write(batch, 16);
+        ring.read(batch + 16, 16);
+    }
+    elapsed = monotonicNs() - start;
+    printf("%-10s %8.1f ns/record in batches of 16 on one thread\n", name, (double)elapsed / records);
+
+    start = monotonicNs();
+    std::thread producer([&]() {
+        MPU6050sample samples[16];
+        memset(samples, 0, sizeof(samples));
+        for (uint32_t sent = 0; sent < records; ) {
+            for (int i = 0; i < 16; i++) samples[i].sequence = sent + i;
+            uint32_t n = ring.write(samples, records - sent < 16 ? records - sent : 16);
+            // a real producer moves on; this one resends so every record arrives
+            sent += n;
+            if (n == 0) std::this_thread::yield();
+        }
+    });
+    while (expected < records) {
+        if (ring.wait(1000) == 0) break;
+        size_t n = ring.read(batch, 64);
+        for (size_t i = 0; i < n; i++, expected++) {
+            if (batch[i].sequence != expected) disordered++;
+        }
+    }
+    producer.join();
+    elapsed = monotonicNs() - start;
+    printf("%-10s %8u records %8.1f ns/record, %u out of order, %llu dropped while full\n", name, expected,
+        (double)elapsed / records, disordered, (unsigned long long)ring.dropped());
+    return expected == records && disordered == 0 ? 0 : 1;
+}
+
+// Write-back buffering with several writers at once: the caller, a second
+// thread (read-modify-write through the cache) and the I2Cengine worker each
+// own one MPU6050 register, while a fourth thread keeps flushing. Once all
+// have stopped and the last flush is done, the model must hold the last value
+// written to each register. Then the bus transfers of a loop pass that sets
+// three FIFO_EN bits, written through and buffered.
+static int writebackBench(int iterations) {
+    static const uint8_t regs[3] = { MPU6050_RA_I2C_SLV0_ADDR, MPU6050_RA_I2C_SLV1_ADDR, MPU6050_RA_I2C_SLV2_ADDR };
+    I2Csim sim;
+    MPU6050sim mpuModel;
+    MPU6050 mpu;
+    I2Cengine *engine;
+    I2Cstats::BusSnapshot before, after;
+    std::atomic<bool> running(true);
+    uint32_t flushes = 0, queueFull = 0;
+    int mismatched = 0;
+    uint8_t last;
+
+    sim.setRealTime(false);
+    sim.attach(MPU6050_DEFAULT_ADDRESS, &mpuModel);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &sim);
+    mpu.initialize();
+    mpu.setRegisterWriteBackEnabled(true);
+    if ((engine = I2Cengine::get()) == NULL) {
+        fprintf(stderr, "cannot start the bus engine: %s\n", strerror(errno));
+        I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+        return 1;
+    }
+
+    std::thread flusher([&]() {
+        while (running.load(std::memory_order_relaxed)) {
+            mpu.flushRegisters();
+            flushes++;
+        }
+    });
+    std::thread modifier([&]() {
+        for (int i = 0; i < iterations; i++) I2Cdev::writeBits(MPU6050_DEFAULT_ADDRESS, regs[2], 6, 7, i);
+    });
+    for (int i = 0; i < iterations; i++) {
+        uint8_t value = i & 0x7F;
+        I2Cdev::writeByte(MPU6050_DEFAULT_ADDRESS, regs[0], value);
+        while (!engine->writeBytes(MPU6050_DEFAULT_ADDRESS, regs[1], 1, &value, NULL, NULL)) {
+            queueFull++;
+            std::this_thread::yield();
+        }
+    }
+    last = (iterations - 1) & 0x7F;
+    // requests run in order, so this one completing means every one has
+    engine->writeBytes(MPU6050_DEFAULT_ADDRESS, regs[1], 1, &last).wait();
+    modifier.join();
+    running = false;
+    flusher.join();
+    mpu.flushRegisters();
+    for (int r = 0; r < 3; r++) {
+        if (mpuModel.peek(regs[r]) != last) mismatched++;
+    }
+    printf("writers    %8d writes each, %u flushes, %u queue full, %d of 3 registers stale\n",
+        iterations, flushes, queueFull, mismatched);
+
+    for (int writeBack = 0; writeBack < 2; writeBack++) {
+        mpu.setRegisterWriteBackEnabled(writeBack);
+        I2Cstats::busSnapshot(I2CBUS_DEFAULT_ADAPTER, before);
+        for (int i = 0; i < iterations; i++) {
+            mpu.setXGyroFIFOEnabled(i & 1);
+            mpu.setYGyroFIFOEnabled(i & 1);
+            mpu.setZGyroFIFOEnabled(i & 1);
+            if (writeBack) mpu.flushRegisters();
+        }
+        I2Cstats::busSnapshot(I2CBUS_DEFAULT_ADAPTER, after);
+        printf("%-10s %8.2f transfers per pass of three bit setters\n", writeBack ? "write-back" : "through",
+            (double)(after.transfers - before.transfers) / iterations);
+    }
+    mpu.setRegisterCacheEnabled(false);
+    I2Cengine::stopAll();
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    return mismatched == 0 ? 0 : 1;
+}
+
+// Counts I2Cengine completions from the bus worker.
+struct EngineTally {
+    std::atomic<uint32_t> completed;
+    std::atomic<uint32_t> failed;
+};
+
+static void tallyCompletion(void *context, int8_t status) {
+    EngineTally *tally = (EngineTally *)context;
+    if (status <= 0) tally->failed++;
+    tally->completed++;
+}
+
+// I2Cengine on the simulated bus: several threads queue writes to a
+// register of their own, then read it back through a future, which must
+// find the last value each wrote; every callback must come back with
+// success. Then the cost of a queued write against a direct I2Cdev write,
+// and the status of requests that fail or time out.
+static int engineBench(int iterations) {
+    static const uint8_t regs[4] = { MPU6050_RA_I2C_SLV0_ADDR, MPU6050_RA_I2C_SLV1_ADDR, MPU6050_RA_I2C_SLV2_ADDR,
+        MPU6050_RA_I2C_SLV3_ADDR };
+    const uint16_t dev = MPU6050_DEFAULT_ADDRESS;
+    I2Csim sim;
+    MPU6050sim mpuModel;
+    I2Cengine *engine;
+    EngineTally tally;
+    std::thread producers[4];
+    std::atomic<uint32_t> queueFull(0);
+    std::atomic<int> stale(0);
+    uint64_t start, queued, direct;
+    int8_t absent, late;
+    uint8_t value;
+    int problems = 0;
+
+    sim.setRealTime(false);
+    sim.attach(dev, &mpuModel);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &sim);
+    I2Cerrors::setLogging(false);
+    if ((engine = I2Cengine::get()) == NULL) {
+        fprintf(stderr, "cannot start the bus engine: %s\n", strerror(errno));
+        I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+        return 1;
+    }
+    tally.completed = 0;
+    tally.failed = 0;
+
+    start = monotonicNs();
+    for (int t = 0; t < 4; t++) {
+        producers[t] = std::thread([&, t]() {
+            uint8_t readBack = 0xFF;
+            for (int i = 0; i < iterations; i++) {
+                uint8_t data = (i + t) & 0x7F;
+                while (!engine->writeBytes(dev, regs[t], 1, &data, tallyCompletion, &tally)) {
+                    queueFull++;
+                    std::this_thread::yield();
+                }
+            }
+            // a thread's requests run in the order it queued them
+            if (engine->readBytes(dev, regs[t], 1, &readBack).get() <= 0 ||
+                readBack != ((iterations - 1 + t) & 0x7F)) {
+                stale++;
+            }
+        });
+    }
+    for (int t = 0; t < 4; t++) producers[t].join();
+    queued = monotonicNs() - start;
+    printf("engine     %8d writes from each of 4 threads, %.2f us/request, %u completed, %u failed, "
+        "%u queue full, %d of 4 registers stale\n", iterations, (double)queued / (4 * (iterations + 1)) / 1000.0,
+        tally.completed.load(), tally.failed.load(), queueFull.load(), stale.load());
+    if (tally.completed != 4u * iterations || tally.failed != 0 || stale != 0) problems++;
+
+    start = monotonicNs();
+    for (int i = 0; i < iterations; i++) I2Cdev::writeByte(dev, regs[0], i & 0x7F);
+    direct = monotonicNs() - start;
+    printf("direct     %8d writes, %.2f us/write\n", iterations, (double)direct / iterations / 1000.0);
+
+    // an address nobody answers fails; a request whose deadline has passed
+    // times out without reaching the bus
+    absent = engine->readBytes(0x50, 0, 1, &value).get();
+    I2Cdev::setDeadline(1);
+    late = engine->readBytes(dev, regs[0], 1, &value).get();
+    I2Cdev::setDeadline(0);
+    printf("status     %8d from an absent device, %d past the deadline\n", absent, late);
+    if (absent != 0 || late != -1) problems++;
+
+    I2Cengine::stopAll();
+    I2Cerrors::setLogging(true);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    return problems == 0 ? 0 : 1;
+}
+
+// Subroutine of schedulerTask(): reads a register back and compares it.
+static I2Ctask schedulerCheck(I2Cscheduler &sched, uint8_t reg, uint8_t expected, int *mismatched) {
+    I2Cresult r = co_await sched.read(MPU6050_DEFAULT_ADDRESS, reg, 1);
+    if (r.status <= 0 || r.data[0] != expected) (*mismatched)++;
+}
+
+// One I2Cscheduler task: writes its own register, reads it back through a
+// subroutine task, then optionally sleeps; counts how often it overslept.
+static I2Ctask schedulerTask(I2Cscheduler &sched, uint8_t reg, int rounds, uint32_t delayMs, int *mismatched,
+        int *late) {
+    for (int i = 0; i < rounds; i++) {
+        uint8_t value = (i + reg) & 0x7F;
+        if (co_await sched.write(MPU6050_DEFAULT_ADDRESS, reg, 1, &value) <= 0) (*mismatched)++;
+        co_await schedulerCheck(sched, reg, value, mismatched);
+        if (delayMs == 0) continue;
+        uint64_t start = monotonicNs();
+        co_await sched.delay(delayMs);
+        uint64_t slept = monotonicNs() - start;
+        if (slept < delayMs * 1000000ull || slept > (delayMs + 20) * 1000000ull) (*late)++;
+    }
+}
+
+// I2Cscheduler on the simulated bus, all tasks on this thread: many tasks
+// that write and read back a register of their own as fast as the engine
+// takes them, then tasks that sleep between rounds, whose delays must
+// overlap rather than add up.
+static int schedulerBench(int iterations) {
+    const int tasks = 16, sleepers = 8, rounds = 10;
+    const uint32_t delayMs = 5;
+    I2Csim sim;
+    MPU6050sim mpuModel;
+    int mismatched = 0, late = 0, problems = 0;
+    uint64_t start, elapsed;
+
+    sim.setRealTime(false);
+    sim.attach(MPU6050_DEFAULT_ADDRESS, &mpuModel);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &sim);
+    {
+        I2Cscheduler sched;
+        start = monotonicNs();
+        // I2C_SLV0_ADDR to I2C_SLV4_CTRL hold whatever is written to them
+        for (int t = 0; t < tasks; t++) {
+            sched.spawn(schedulerTask(sched, MPU6050_RA_I2C_SLV0_ADDR + t, iterations, 0, &mismatched, &late));
+        }
+        sched.run();
+        elapsed = monotonicNs() - start;
+        printf("scheduler  %8d tasks x %d rounds, %.2f us/transfer, %d mismatched, %d still active\n",
+            tasks, iterations, (double)elapsed / (tasks * iterations * 2) / 1000.0, mismatched, sched.active());
+        if (mismatched != 0 || sched.active() != 0) problems++;
+    }
+    {
+        I2Cscheduler sched;
+        mismatched = 0;
+        start = monotonicNs();
+        for (int t = 0; t < sleepers; t++) {
+            sched.spawn(schedulerTask(sched, MPU6050_RA_I2C_SLV0_ADDR + t, rounds, delayMs, &mismatched, &late));
+        }
+        sched.run();
+        elapsed = monotonicNs() - start;
+        printf("delays     %8d tasks x %d rounds of %u ms in %.1f ms, %d mismatched, %d overslept\n",
+            sleepers, rounds, delayMs, elapsed / 1e6, mismatched, late);
+        // together they sleep for sleepers * rounds * delayMs, but only
+        // rounds * delayMs if the delays overlap
+        if (mismatched != 0 || late > sleepers * rounds / 10 ||
+            elapsed < rounds * delayMs * 1000000ull || elapsed >= 2ull * rounds * delayMs * 1000000ull) {
+            problems++;
+        }
+    }
+    I2Cengine::stopAll();
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    return problems == 0 ? 0 : 1;
+}
+
+// Hands messages on to a register model, but NACKs every nth one or, while
+// down, all of them.
+class NackingModel : public I2Cmodel {
+    public:
+        NackingModel(I2Cmodel *inner) : every(0), down(false), messages(0), nacks(0), inner(inner) {}
+
+        int write(const uint8_t *buf, uint16_t length) { return nack() ? -1 : inner->write(buf, length); }
+        int read(uint8_t *buf, uint16_t length) { return nack() ? -1 : inner->read(buf, length); }
+
+        uint32_t every;
+        bool down;
+        uint32_t messages;
+        uint32_t nacks;
+
+    private:
+        bool nack() {
+            if (!down && (every == 0 || ++messages % every != 0)) return false;
+            nacks++;
+            errno = EREMOTEIO;
+            return true;
+        }
+
+        I2Cmodel *inner;
+};
+
+// I2Cretry against a simulated MPU6050 that NACKs: occasional NACKs are
+// retried away, a dead device is retried with growing pauses and then
+// sidelined, the probe after the cooldown is a single attempt that reopens
+// the breaker when it fails or times out, and a device that answers again,
+// or is reset, is back in service.
+static int retryBench(int iterations) {
+    const uint16_t dev = MPU6050_DEFAULT_ADDRESS;
+    const uint8_t reg = MPU6050_RA_I2C_SLV0_ADDR;
+    const uint16_t backoffUs = 1000, cooldownMs = 50;
+    const uint8_t retries = 3, threshold = 5;
+    I2Csim sim;
+    MPU6050sim mpuModel;
+    NackingModel model(&mpuModel);
+    uint32_t nacks, errors, trips;
+    uint64_t start, elapsed, minimum = 0;
+    int failed[2] = { 0, 0 }, refused = 0, problems = 0;
+    int8_t status;
+    uint8_t value;
+    bool ok;
+
+    sim.setRealTime(false);
+    sim.attach(dev, &model);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, &sim);
+    I2Cerrors::setLogging(false);
+
+    // every seventh message NACKed, without and with a policy
+    model.every = 7;
+    for (int policy = 0; policy < 2; policy++) {
+        if (policy) I2Cretry::enable(dev, retries, backoffUs / 10, threshold, cooldownMs);
+        nacks = model.nacks;
+        errors = I2Cerrors::count(dev, EREMOTEIO);
+        for (int i = 0; i < iterations; i++) {
+            value = 0;
+            if (!I2Cdev::writeByte(dev, reg, i & 0x7F) || I2Cdev::readByte(dev, reg, &value) <= 0 ||
+                value != (i & 0x7F)) {
+                failed[policy]++;
+            }
+        }
+        printf("%-10s %8d write+read pairs, %u NACKs, %u failed attempts, %d pairs failed\n",
+            policy ? "retried" : "single", iterations, model.nacks - nacks, I2Cerrors::count(dev, EREMOTEIO) - errors,
+            failed[policy]);
+    }
+    if (failed[1] != 0) problems++;
+    model.every = 0;
+
+    // a dead device: every operation is tried 1 + retries times, pausing
+    // at least half of backoff, 2 backoff, 4 backoff... in between
+    I2Cretry::enable(dev, retries, backoffUs, threshold, cooldownMs);
+    model.down = true;
+    for (int i = 0; i < retries; i++) minimum += (uint64_t)(backoffUs << i) * 500;
+    nacks = model.nacks;
+    start = monotonicNs();
+    ok = I2Cdev::writeByte(dev, reg, 1);
+    elapsed = monotonicNs() - start;
+    printf("backoff    %8u attempts in %.2f ms, at least %.2f ms of pauses expected\n",
+        model.nacks - nacks, elapsed / 1e6, minimum / 1e6);
+    if (ok || model.nacks - nacks != 1u + retries || elapsed < minimum) problems++;
+
+    // the threshold-th failed operation in a row sidelines it; after that
+    // nothing reaches the bus
+    for (int i = 1; i < threshold; i++) I2Cdev::readByte(dev, reg, &value);
+    nacks = model.nacks;
+    for (int i = 0; i < iterations; i++) {
+        if (I2Cdev::readByte(dev, reg, &value) == 0 && errno == EHOSTDOWN) refused++;
+    }
+    printf("breaker    %8s after %u failed operations, %d of %d refused, %u NACKs while open\n",
+        I2Cretry::tripped(dev) ? "open" : "closed", threshold, refused, iterations, model.nacks - nacks);
+    if (!I2Cretry::tripped(dev) || refused != iterations || model.nacks != nacks) problems++;
+
+    // after the cooldown one attempt goes out; it fails, so the breaker
+    // opens again at once
+    usleep(cooldownMs * 1000 + 5000);
+    nacks = model.nacks;
+    trips = I2Cretry::trips(dev);
+    I2Cdev::readByte(dev, reg, &value);
+    ok = I2Cdev::readByte(dev, reg, &value) == 0 && errno == EHOSTDOWN;
+    printf("probe      %8u attempt, breaker %s, %u trips\n", model.nacks - nacks,
+        ok ? "open again" : "not reopened", I2Cretry::trips(dev));
+    if (model.nacks - nacks != 1 || !ok || I2Cretry::trips(dev) != trips + 1) problems++;
+
+    // a probe that runs out of time ends like one that failed
+    usleep(cooldownMs * 1000 + 5000);
+    trips = I2Cretry::trips(dev);
+    I2Cdev::setDeadline(1);
+    status = I2Cdev::readByte(dev, reg, &value);
+    I2Cdev::setDeadline(0);
+    printf("timed out  %8d status, breaker %s, %u trips\n", status, I2Cretry::tripped(dev) ? "open" : "closed",
+        I2Cretry::trips(dev));
+    if (status >= 0 || I2Cretry::trips(dev) != trips + 1) problems++;
+
+    // the device answers again: the next probe closes the breaker
+    model.down = false;
+    usleep(cooldownMs * 1000 + 5000);
+    ok = I2Cdev::readByte(dev, reg, &value) > 0;
+    printf("recovered  %8s probe, breaker %s\n", ok ? "passed" : "failed", I2Cretry::tripped(dev) ? "open" : "closed");
+    if (!ok || I2Cretry::tripped(dev)) problems++;
+
+    // reset() puts a sidelined device back in service without the cooldown
+    model.down = true;
+    for (int i = 0; i < threshold; i++) I2Cdev::readByte(dev, reg, &value);
+    trips = I2Cretry::trips(dev);
+    model.down = false;
+    I2Cretry::reset(dev);
+    ok = I2Cdev::readByte(dev, reg, &value) > 0;
+    printf("reset      %8s at once, %u trips\n", ok ? "answered" : "refused", trips);
+    if (!ok || I2Cretry::tripped(dev)) problems++;
+
+    I2Cretry::disable(dev);
+    I2Cerrors::setLogging(true);
+    I2Cbus::setTransport(I2CBUS_DEFAULT_ADAPTER, NULL);
+    return problems == 0 ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    uint8_t adapter = I2CBUS_DEFAULT_ADAPTER;
+    uint8_t devAddr = MPU6050_DEFAULT_ADDRESS;
+    uint8_t regAddr = MPU6050_RA_ACCEL_XOUT_H;
+    uint8_t length = 14;
+    int iterations = 10000;
+    uint8_t buffer[255];
+    int failures, i;
+    uint64_t start, uncached, split, combined;
+
+    if (argc > 1 && strcmp(argv[1], "sim") == 0) {
+        if (argc > 2) iterations = atoi(argv[2]);
+        if (argc > 4 || iterations <= 0) {
+            fprintf(stderr, "usage: %s sim [iterations] [trace]\n", argv[0]);
+            return 1;
+        }
+        return simBench(iterations, argc > 3 ? argv[3] : NULL);
+    }
+    if (argc > 1 && strcmp(argv[1], "replay") == 0) {
+        if (argc > 3) iterations = atoi(argv[3]);
+        if (argc < 3 || argc > 4 || iterations <= 0) {
+            fprintf(stderr, "usage: %s replay trace [iterations]\n", argv[0]);
+            return 1;
+        }
+        return replayBench(iterations, argv[2]);
+    }
+    if (argc > 1 && strcmp(argv[1], "scan") == 0) {
+        if (argc > 3) {
+            fprintf(stderr, "usage: %s scan [cache]\n", argv[0]);
+            return 1;
+        }
+        return scanBench(argc > 2 ? argv[2] : "/tmp/i2cbench-topology");
+    }
+    if (argc > 1 && strcmp(argv[1], "stream") == 0) {
+        int ms = argc > 2 ? atoi(argv[2]) : 1000;
+        if (argc > 3 || ms <= 0) {
+            fprintf(stderr, "usage: %s stream [ms]\n", argv[0]);
+            return 1;
+        }
+        return streamBench(ms);
+    }
+    if (argc > 1 && strcmp(argv[1], "irq") == 0) {
+        int ms = argc > 2 ? atoi(argv[2]) : 1000;
+        if (argc > 3 || ms <= 0) {
+            fprintf(stderr, "usage: %s irq [ms]\n", argv[0]);
+            return 1;
+        }
+        return irqBench(ms);
+    }
+    if (argc > 1 && strcmp(argv[1], "ring") == 0) {
+        int records = argc > 2 ? atoi(argv[2]) : 1000000;
+        if (argc > 3 || records <= 0) {
+            fprintf(stderr, "usage: %s ring [records]\n", argv[0]);
+            return 1;
+        }
+        return ringBench<I2CringSpin>("spin", records) | ringBench<I2CringFutex>("futex", records) |
+            ringBench<I2CringEventfd>("eventfd", records);
+    }
+    if (argc > 1 && strcmp(argv[1], "writeback") == 0) {
+        if (argc > 2) iterations = atoi(argv[2]);
+        if (argc > 3 || iterations <= 0) {
+            fprintf(stderr, "usage: %s writeback [iterations]\n", argv[0]);
+            return 1;
+        }
+        return writebackBench(iterations);
+    }
+    if (argc > 1 && strcmp(argv[1], "engine") == 0) {
+        if (argc > 2) iterations = atoi(argv[2]);
+        if (argc > 3 || iterations <= 0) {
+            fprintf(stderr, "usage: %s engine [iterations]\n", argv[0]);
+            return 1;
+        }
+        return engineBench(iterations);
+    }
+    if (argc > 1 && strcmp(argv[1], "sched") == 0) {
+        iterations = argc > 2 ? atoi(argv[2]) : 1000;
+        if (argc > 3 || iterations <= 0) {
+            fprintf(stderr, "usage: %s sched [iterations]\n", argv[0]);
+            return 1;
+        }
+        return schedulerBench(iterations);
+    }
+    if (argc > 1 && strcmp(argv[1], "retry") == 0) {
+        iterations = argc > 2 ? atoi(argv[2]) : 1000;
+        if (argc > 3 || iterations <= 0) {
+            fprintf(stderr, "usage: %s retry [iterations]\n", argv[0]);
+            return 1;
+        }
+        return retryBench(iterations);
+    }
+    if (argc > 1) adapter = strtoul(argv[1], NULL, 0);
+    if (argc > 2) devAddr = strtoul(argv[2], NULL, 0);
+    if (argc > 3) regAddr = strtoul(argv[3], NULL, 0);
+    if (argc > 4) length = strtoul(argv[4], NULL, 0);
+    if (argc > 5) iterations = atoi(argv[5]);
+    if (argc > 6 || iterations <= 0 || length == 0) {
+        fprintf(stderr, "usage: %s [adapter] [devAddr] [regAddr] [length] [iterations]\n"
+            "       %s sim [iterations] [trace]\n"
+            "       %s replay trace [iterations]\n"
+            "       %s scan [cache]\n"
+            "       %s stream [ms]\n"
+            "       %s irq [ms]\n"
+            "       %s ring [records]\n"
+            "       %s writeback [iterations]\n"
+            "       %s engine [iterations]\n"
+            "       %s sched [iterations]\n"
+            "       %s retry [iterations]\n", argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0],
+            argv[0], argv[0], argv[0], argv[0]);
+        return 1;
+    }
+
+    printf("/dev/i2c-%u addr 0x%02x reg 0x%02x, %u byte reads\n", adapter, devAddr, regAddr, length);
+
+    failures = 0;
+    start = monotonicNs();
+    for (i = 0; i < iterations; i++) {
+        if (uncachedRead(adapter, devAddr, regAddr, length, buffer) != length) failures++;
+    }
+    uncached = monotonicNs() - start;
+    report("uncached", uncached, iterations, failures);
+
+    failures = 0;
+    start = monotonicNs();
+    for (i = 0; i < iterations; i++) {
+        if (splitRead(adapter, devAddr, regAddr, length, buffer) != length) failures++;
+    }
+    split = monotonicNs() - start;
+    report("split", split, iterations, failures);
+
+    failures = 0;
+    start = monotonicNs();
+    for (i = 0; i < iterations; i++) {
+        if (I2Cdev::readBytes(I2CBUS_ADDRESS(adapter, devAddr), regAddr, length, buffer) <= 0) failures++;
+    }
+    combined = monotonicNs() - start;
+    report("combined", combined, iterations, failures);
+
+    printf("saved      %10.1f us/read\n", ((double)uncached - (double)combined) / iterations / 1000.0);
+    I2Cstats::dump(stdout);
+    return 0;
+}
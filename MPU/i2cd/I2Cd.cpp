@@ -0,0 +1,64 @@
+/**********************************************************************
+* Filename    : I2Cd.cpp
+* Description : I2C bus manager daemon: owns /dev/i2c-N and runs the
+*               requests every I2Cremote client process queues in the
+*               shared-memory segment, so processes share the bus
+*               without interleaving; "i2cd N sim" serves the simulated
+*               MPU6050 and PCA9685 instead of the real adapter
+**********************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include "I2Cbus.h"
+#include "I2Clinux.h"
+#include "I2Csim.h"
+#include "I2Cmanager.h"
+#include "MPU6050.h"
+#include "MPU6050sim.h"
+#include "PCA9685sim.h"
+
+static I2Cmanager *manager;
+
+static void terminate(int signum) {
+    (void)signum;
+    manager->stop();
+}
+
+int main(int argc, char **argv) {
+    uint8_t adapter = I2CBUS_DEFAULT_ADAPTER;
+    bool simulated = false;
+    I2Clinux device;
+    I2Csim sim;
+    MPU6050sim mpuModel;
+    PCA9685sim pwmModel;
+    struct sigaction action;
+
+    if (argc > 1) adapter = strtoul(argv[1], NULL, 0);
+    if (argc > 2) simulated = strcmp(argv[2], "sim") == 0;
+    if (argc > 3 || (argc > 2 && !simulated) || adapter >= I2CBUS_MAX_ADAPTERS) {
+        fprintf(stderr, "usage: %s [adapter] [sim]\n", argv[0]);
+        return 1;
+    }
+    sim.attach(MPU6050_DEFAULT_ADDRESS, &mpuModel);
+    sim.attach(PCA9685SIM_DEFAULT_ADDRESS, &pwmModel);
+
+    I2Cmanager bus(simulated ? (I2Ctransport *)&sim : &device);
+    manager = &bus;
+    if (bus.start(adapter) < 0) {
+        fprintf(stderr, "%s: cannot serve /dev/i2c-%u: %s\n", argv[0], adapter, strerror(errno));
+        return 1;
+    }
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = terminate;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    printf("serving /dev/i2c-%u%s\n", adapter, simulated ? " (simulated)" : "");
+    bus.run();
+    printf("%llu requests in %llu transfers\n", (unsigned long long)bus.requests(),
+        (unsigned long long)bus.batches());
+    return 0;
+}
@@ -113,8 +113,6 @@ private:
 
 private:
 	std::uint8_t m_nAddress { I2C_ADDRESS_DEFAULT };
-	int m_i2c_handle {};
-	int m_pi {};
 };
 
 };
\ No newline at end of file
@@ -28,7 +28,8 @@
 #include <cassert>
 #include <unistd.h>
 
-#include <pigpiod_if2.h>
+#include "I2Cdev.h"
+#include "I2Cbus.h"
 
 #include "pca9685.h"
 
@@ -80,13 +81,6 @@ enum TPCA9685Mode2 {
 };
 
 PCA9685::PCA9685(std::uint8_t nAddress) : m_nAddress(nAddress) {
-	m_pi = pigpio_start(nullptr, nullptr);
-	if (m_pi < 0) return;
-
-	m_i2c_handle = i2c_open(1, 0, m_nAddress, 0x0);
-	if(m_i2c_handle < 0)
-		return;
-
 	AutoIncrement(true);
 
 	for (std::uint8_t i = 0; i < 16; i ++) {
@@ -97,12 +91,10 @@ PCA9685::PCA9685(std::uint8_t nAddress) : m_nAddress(nAddress) {
 }
 
 PCA9685::~PCA9685(void) {
-	i2c_close(m_pi, m_i2c_handle);
-	pigpio_stop(m_pi);
 }
 
 void PCA9685::Sleep(bool const bMode) {
-	std::uint8_t Data = i2c_read_byte_data( m_pi, m_i2c_handle, TPCA9685Reg::MODE1);
+	std::uint8_t Data = I2cReadReg(TPCA9685Reg::MODE1);
 
 	Data &= ~TPCA9685Mode1::SLEEP;
 
@@ -310,6 +302,8 @@ std::uint16_t PCA9685::CalcFrequency(uint8_t const nPreScale) {
 }
 
 void PCA9685::Dump(void) {
+	I2Cpriority bulk(I2CBUS_PRIORITY_BULK);	// 37 register reads nobody is waiting for
+
 	std::uint8_t reg = I2cReadReg(TPCA9685Reg::MODE1);
 
 	printf("MODE1 - Mode register 1 (address 00h) : %02Xh\n", reg);
@@ -377,7 +371,7 @@ void PCA9685::I2cWriteReg(std::uint8_t const reg, std::uint8_t const data) {
 	// buffer[1] = data;
 
 	I2cSetup();
-	i2c_write_byte_data(m_pi, m_i2c_handle, reg, data);
+	I2Cdev::writeByte(m_nAddress, reg, data);
 	// i2c_write(buffer, 2);
 }
 
@@ -388,41 +382,35 @@ std::uint8_t PCA9685::I2cReadReg(std::uint8_t const reg) {
 
 	// i2c_write(&data, 1);
 	// i2c_read(&data, 1);
-	std::uint8_t const data { i2c_read_byte_data(m_pi, m_i2c_handle, reg) };
+	std::uint8_t data { 0 };
+	I2Cdev::readByte(m_nAddress, reg, &data);
 
 	return data;
 }
 
 void PCA9685::I2cWriteReg(std::uint8_t const reg, std::uint16_t const data) {
-	// char buffer[3];
+	std::uint8_t buffer[2];
 
-	// buffer[0] = reg;
-	// buffer[1] = (data & 0xFF);
-	// buffer[2] = (data >> 8);
+	buffer[0] = (data & 0xFF);
+	buffer[1] = (data >> 8);
 
 	I2cSetup();
 
-	i2c_write_word_data(m_pi, m_i2c_handle, reg, data);
-	// i2c_write(buffer, 3);
+	I2Cdev::writeBytes(m_nAddress, reg, 2, buffer);
 }
 
 std::uint16_t PCA9685::I2cReadReg16(uint8_t const reg) {
-	// char data = reg;
-	// char buffer[2] = { 0, 0 };
+	std::uint8_t buffer[2] = { 0, 0 };
 
 	I2cSetup();
 
-	std::uint16_t const ret { i2c_read_word_data(m_pi, m_i2c_handle, reg) };
-
-	// i2c_write(&data, 1);
-	// i2c_read(reinterpret_cast<char *>(&buffer), 2);
+	I2Cdev::readBytes(m_nAddress, reg, 2, buffer);
 
-	// return (buffer[1] << 8) | buffer[0];
-	return ret;
+	return (buffer[1] << 8) | buffer[0];
 }
 
 void PCA9685::I2cWriteReg(std::uint8_t const reg, uint16_t const data0, uint16_t const data1) {
-	char buffer[4];
+	std::uint8_t buffer[4];
 
 	buffer[0] = (data0 & 0xFF);
 	buffer[1] = (data0 >> 8);
@@ -431,8 +419,7 @@ void PCA9685::I2cWriteReg(std::uint8_t const reg, uint16_t const data0, uint16_t
 
 	I2cSetup();
 
-	i2c_write_block_data(m_pi, m_i2c_handle, reg, buffer, 32);
-	// i2c_write(buffer, 5);
+	I2Cdev::writeBytes(m_nAddress, reg, 4, buffer);
 }
 
 };
\ No newline at end of file